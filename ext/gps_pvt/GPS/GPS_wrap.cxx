@@ -1947,11 +1947,21 @@ static VALUE mGPS;
 #endif
 
 #include <string>
+#include <cstring>
 #include <vector>
+#include <map>
 #include <iostream>
 #include <fstream>
 #include <exception>
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "navigation/GPS.h"
 #include "navigation/SBAS.h"
@@ -1969,6 +1979,8 @@ static VALUE mGPS;
 #include "navigation/SBAS_Solver.h"
 #include "navigation/GLONASS_Solver.h"
 
+#include <ruby/thread.h>
+
 #if defined(__cplusplus) && (__cplusplus < 201103L)
 namespace std {
 template <class T>
@@ -2345,6 +2357,303 @@ static std::string inspect_str(const VALUE &v){
   VALUE v_inspect(rb_inspect(v));
   return std::string(RSTRING_PTR(v_inspect), RSTRING_LEN(v_inspect));
 }
+/**
+ * Input stream for readers of RINEX, SP3, and so on.
+ * Source is a file designated by String (or object responding to to_path), which is memory-mapped if possible,
+ * an in-memory buffer of StringIO (object responding to string), whose content is used without copy,
+ * or IO-like object responding to read(length), for example, Zlib::GzipReader,
+ * whose content is pulled on demand so that decompression and parsing are pipelined.
+ */
+struct input_stream_t {
+  struct io_buf_t : public std::streambuf {
+    VALUE io;
+    int state; // non-zero when an exception is raised in reading
+    char buf[0x10000];
+    std::string rest; // excess of what read(length) returned, which is served later
+    std::size_t rest_pos;
+    io_buf_t() : std::streambuf(), io(Qnil), state(0), rest(), rest_pos(0) {}
+    static VALUE read(VALUE v){
+      static const ID id_read(rb_intern("read"));
+      io_buf_t *self(reinterpret_cast<io_buf_t *>(v));
+      return rb_funcall(self->io, id_read, 1, INT2FIX(sizeof(self->buf)));
+    }
+    int_type underflow(){
+      if(gptr() < egptr()){return traits_type::to_int_type(*gptr());}
+      if(rest_pos >= rest.size()){
+        rest.clear();
+        rest_pos = 0;
+        if(NIL_P(io) || (state != 0)){return traits_type::eof();}
+        VALUE res(rb_protect(read, reinterpret_cast<VALUE>(this), &state));
+        if((state != 0) || (!RB_TYPE_P(res, T_STRING))){return traits_type::eof();} // nil means EOF
+        std::size_t len(RSTRING_LEN(res));
+        if(len == 0){return traits_type::eof();}
+        if(len <= sizeof(buf)){
+          std::memcpy(buf, RSTRING_PTR(res), len);
+          setg(buf, buf, buf + len);
+          return traits_type::to_int_type(*gptr());
+        }
+        rest.assign(RSTRING_PTR(res), len); // IO-like object may return more than requested
+      }
+      std::size_t len(rest.size() - rest_pos);
+      if(len > sizeof(buf)){len = sizeof(buf);}
+      std::memcpy(buf, rest.data() + rest_pos, len);
+      rest_pos += len;
+      setg(buf, buf, buf + len);
+      return traits_type::to_int_type(*gptr());
+    }
+  } io;
+  struct memory_buf_t : public std::streambuf {
+    void assign(const char *head, const std::size_t &size){
+      char *p(const_cast<char *>(head)); // read only
+      setg(p, p, p + size);
+    }
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+        std::ios_base::openmode which = std::ios_base::in){
+      if(!(which & std::ios_base::in)){return pos_type(off_type(-1));}
+      char *p;
+      switch(dir){
+        case std::ios_base::beg: p = eback() + off; break;
+        case std::ios_base::cur: p = gptr() + off; break;
+        case std::ios_base::end: p = egptr() + off; break;
+        default: return pos_type(off_type(-1));
+      }
+      if((p < eback()) || (p > egptr())){return pos_type(off_type(-1));}
+      setg(eback(), p, egptr());
+      return pos_type(p - eback());
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in){
+      return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+  } mem;
+  std::filebuf file;
+  std::istream in;
+  VALUE buffer;
+  void *mapped;
+  std::size_t mapped_size;
+  input_stream_t(VALUE src) : io(), mem(), file(), in(NULL), buffer(Qnil), mapped(NULL), mapped_size(0) {
+    static const ID
+        id_string(rb_intern("string")), id_pos(rb_intern("pos")),
+        id_to_path(rb_intern("to_path")), id_read(rb_intern("read"));
+    if(!RB_TYPE_P(src, T_STRING)){
+      if(rb_respond_to(src, id_string)){
+        buffer = rb_funcall(src, id_string, 0);
+        if(!RB_TYPE_P(buffer, T_STRING)){
+          buffer = Qnil;
+          throw std::invalid_argument(std::string("Unexpected buffer: ").append(inspect_str(src)));
+        }
+        long offset(rb_respond_to(src, id_pos) ? NUM2LONG(rb_funcall(src, id_pos, 0)) : 0);
+        if((offset < 0) || (offset > RSTRING_LEN(buffer))){offset = RSTRING_LEN(buffer);}
+        int state(0);
+        rb_protect(rb_str_locktmp, buffer, &state); // prohibit modification during reading
+        if(state != 0){ // for example, already locked by another reader
+          buffer = Qnil;
+          throw native_exception(state);
+        }
+        rb_gc_register_address(&buffer); // after lock, which destructor releases
+        mem.assign(RSTRING_PTR(buffer) + offset, RSTRING_LEN(buffer) - offset);
+        in.rdbuf(&mem);
+        return;
+      }else if(rb_respond_to(src, id_to_path)
+          && !NIL_P(buffer = rb_funcall(src, id_to_path, 0))){ // IO#to_path may return nil, for example, pipe
+        src = buffer;
+        buffer = Qnil;
+      }else if(rb_respond_to(src, id_read)){
+        io.io = src;
+        rb_gc_register_address(&io.io);
+        in.rdbuf(&io);
+        return;
+      }
+      if(!RB_TYPE_P(src, T_STRING)){
+        throw std::invalid_argument(std::string("Unexpected source: ").append(inspect_str(src)));
+      }
+    }
+    std::string fname(RSTRING_PTR(src), RSTRING_LEN(src));
+#if !defined(_WIN32)
+    int fd(::open(fname.c_str(), O_RDONLY));
+    if(fd >= 0){
+      struct stat st;
+      if((::fstat(fd, &st) == 0) && (st.st_size > 0)){
+        void *p(::mmap(NULL, (std::size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0));
+        if(p != MAP_FAILED){
+          mapped = p;
+          mapped_size = (std::size_t)st.st_size;
+#if defined(MADV_SEQUENTIAL)
+          ::madvise(mapped, mapped_size, MADV_SEQUENTIAL);
+#endif
+        }
+      }
+      ::close(fd);
+      if(mapped){
+        mem.assign(static_cast<const char *>(mapped), mapped_size);
+        in.rdbuf(&mem);
+        return;
+      }
+    }
+#endif
+    // fallback, for example, empty or special file
+    file.open(fname.c_str(), std::ios::in | std::ios::binary);
+    in.rdbuf(&file);
+  }
+  ~input_stream_t(){
+#if !defined(_WIN32)
+    if(mapped){::munmap(mapped, mapped_size);}
+#endif
+    if(!NIL_P(buffer)){
+      rb_str_unlocktmp(buffer);
+      rb_gc_unregister_address(&buffer);
+    }
+    if(!NIL_P(io.io)){
+      rb_gc_unregister_address(&io.io);
+    }
+  }
+  /**
+   * Release resources, and then re-raise the exception occurred in reading IO-like object, if any.
+   */
+  static void release(input_stream_t *&in){
+    if(!in){return;}
+    int state(in->io.state);
+    delete in;
+    in = NULL;
+    if(state != 0){rb_jump_tag(state);}
+  }
+};
+/**
+ * Lock of a solver, which serializes its tasks instead of GVL, because a task may run without GVL.
+ * Space nodes of the solver are associated with the lock, so that their mutators called in
+ * other threads wait for the running task. It is accessed only with GVL.
+ */
+struct solver_lock_t {
+  VALUE mutex;
+  VALUE owner; // thread holding mutex, or Qnil
+  solver_lock_t() : mutex(rb_mutex_new()), owner(Qnil) {}
+  struct task_t {
+    virtual ~task_t() {}
+    virtual void operator()() = 0;
+  };
+  /**
+   * Run task with holding mutex, which is released through rb_ensure.
+   * The task may be called recursively from Ruby code invoked in the task, for example,
+   * hooks calling Solver#solve; then it runs without locking again.
+   * C++ exceptions thrown by the task are rethrown after the release.
+   */
+  void run(task_t &task){
+    if(owner == rb_thread_current()){
+      task();
+      return;
+    }
+    int state(0);
+    rb_protect(rb_mutex_lock, mutex, &state); // wait for a task running in another thread
+    if(state != 0){throw native_exception(state);}
+    owner = rb_thread_current();
+    struct body_t {
+      solver_lock_t &lock;
+      task_t &task;
+      enum {ERROR_NONE, ERROR_NATIVE, ERROR_INVALID_ARGUMENT, ERROR_RUNTIME} error;
+      int state;
+      std::string message;
+      static VALUE run(VALUE v){
+        body_t *arg(reinterpret_cast<body_t *>(v));
+        try{
+          (arg->task)();
+        }catch(native_exception &e){
+          arg->error = ERROR_NATIVE;
+          arg->state = e.state;
+        }catch(std::invalid_argument &e){
+          arg->error = ERROR_INVALID_ARGUMENT;
+          arg->message = e.what();
+        }catch(std::exception &e){
+          arg->error = ERROR_RUNTIME;
+          arg->message = e.what();
+        }
+        return Qnil;
+      }
+      static VALUE ensure(VALUE v){
+        body_t *arg(reinterpret_cast<body_t *>(v));
+        arg->lock.owner = Qnil;
+        rb_mutex_unlock(arg->lock.mutex);
+        return Qnil;
+      }
+    } body = {*this, task, body_t::ERROR_NONE, 0, std::string()};
+    rb_ensure(
+        body_t::run, reinterpret_cast<VALUE>(&body),
+        body_t::ensure, reinterpret_cast<VALUE>(&body));
+    switch(body.error){
+      case body_t::ERROR_NATIVE: throw native_exception(body.state);
+      case body_t::ERROR_INVALID_ARGUMENT: throw std::invalid_argument(body.message);
+      case body_t::ERROR_RUNTIME: throw std::runtime_error(body.message);
+      default: break;
+    }
+  }
+  /**
+   * Wait for a task running in another thread.
+   * A mutator which neither calls Ruby nor releases GVL can modify the states shared with tasks
+   * after the wait, because no task can start before it returns GVL.
+   * It raises (not throws) an exception when interrupted during the wait.
+   */
+  void wait() const {
+    if(NIL_P(owner) || (owner == rb_thread_current())){return;}
+    rb_mutex_lock(mutex);
+    rb_mutex_unlock(mutex);
+  }
+  typedef std::map<const void *, solver_lock_t *> space_nodes_t;
+  static space_nodes_t &space_nodes(){
+    static space_nodes_t res;
+    return res;
+  }
+  static solver_lock_t *find(const void *space_node){
+    space_nodes_t::const_iterator it(space_nodes().find(space_node));
+    return (it == space_nodes().end()) ? NULL : it->second;
+  }
+  /**
+   * Run task which modifies a space node exclusively to the tasks of its solver, if any.
+   */
+  static void run(const void *space_node, task_t &task){
+    solver_lock_t *lock(find(space_node));
+    if(lock){
+      lock->run(task);
+    }else{
+      task();
+    }
+  }
+  static void wait(const void *space_node){
+    const solver_lock_t *lock(find(space_node));
+    if(lock){lock->wait();}
+  }
+};
+/**
+ * Task to fill space nodes with RINEX NAV, which may call Ruby to read IO-like input.
+ */
+template <class FloatT>
+struct rinex_nav_read_t : public solver_lock_t::task_t {
+  std::istream &in;
+  typename RINEX_NAV_Reader<FloatT>::space_node_list_t &space_nodes;
+  int res;
+  rinex_nav_read_t(
+      std::istream &in_, typename RINEX_NAV_Reader<FloatT>::space_node_list_t &space_nodes_)
+      : solver_lock_t::task_t(), in(in_), space_nodes(space_nodes_), res(0) {}
+  void operator()(){res = RINEX_NAV_Reader<FloatT>::read_all(in, space_nodes);}
+};
+/**
+ * Generation of ephemerides held by each space node of solvers; it is incremented whenever
+ * ephemeris of the node may be added or reselected, and then the solver owning the node
+ * invalidates its cached selection. Space nodes not owned by any solver are not tracked.
+ * It is accessed only with GVL; a solver takes its snapshot before releasing GVL.
+ */
+struct ephemeris_generation_t {
+  typedef std::map<const void *, unsigned int> space_nodes_t;
+  static space_nodes_t &space_nodes(){
+    static space_nodes_t res;
+    return res;
+  }
+  static void increment(const void *space_node){
+    space_nodes_t::iterator it(space_nodes().find(space_node));
+    if(it != space_nodes().end()){++(it->second);}
+  }
+  static unsigned int get(const void *space_node){
+    space_nodes_t::const_iterator it(space_nodes().find(space_node));
+    return (it != space_nodes().end()) ? it->second : 0;
+  }
+};
 
 
 template <class FloatT>
@@ -2456,6 +2765,69 @@ struct GLONASS_Ephemeris
         deltaT));
   }
   
+  /*
+   * Checkpoint of numerical integration, which is advanced by propagation_interval
+   * to let successive constellation() calls with increasing time continue
+   * from the last integrated state instead of from t_b.
+   * Results differ from the integration from t_b only by round-off errors of restart
+   * (position < 1E-2 m, velocity < 1E-5 m/s, which are checked in spec).
+   * It is used by constellation_cached() and by the solver for broadcast ephemeris,
+   * which are called with GVL or under the solver lock, therefore, no extra guard.
+   */
+  static const int propagation_interval = 300; // [s]
+  struct propagation_cache_t {
+    bool valid;
+    FloatT key[12];
+    int deltaT; // checkpoint - t_b [s]
+    eph_t eph;
+    propagation_cache_t() : valid(false), deltaT(0), eph() {}
+    // cache is neither copied nor assigned, which is rebuilt on demand
+    propagation_cache_t(const propagation_cache_t &) : valid(false), deltaT(0), eph() {}
+    propagation_cache_t &operator=(const propagation_cache_t &){
+      valid = false;
+      return *this;
+    }
+    static void make_key(const eph_t &src, FloatT (&key)[12]){
+      GPS_Time<FloatT> t_b(src.base_time());
+      FloatT k[] = {
+        src.xn, src.yn, src.zn,
+        src.xn_dot, src.yn_dot, src.zn_dot,
+        src.xn_ddot, src.yn_ddot, src.zn_ddot,
+        (FloatT)src.t_b, (FloatT)t_b.week, t_b.seconds};
+      std::copy(k, k + 12, key);
+    }
+    typename GPS_SpaceNode<FloatT>::SatelliteProperties::constellation_t constellation(
+        const eph_t &src, const GPS_Time<FloatT> &t_tx, const FloatT &dt_transit = 0){
+      int deltaT_new((int)std::floor((t_tx - src.base_time()) / propagation_interval)
+          * propagation_interval);
+      if(deltaT_new <= 0){return src.constellation(t_tx, dt_transit);}
+      FloatT key_new[12];
+      make_key(src, key_new);
+      if((!valid) || (deltaT_new < deltaT)
+          || (!std::equal(key_new, key_new + 12, key))){
+        eph = src;
+        deltaT = 0;
+        std::copy(key_new, key_new + 12, key);
+        valid = true;
+      }
+      if(deltaT_new > deltaT){
+        typedef typename GLONASS_SpaceNode<FloatT>::SatelliteProperties prop_t;
+        eph = eph_t(
+            typename prop_t::Ephemeris_with_Time(
+              (typename prop_t::Ephemeris)(eph),
+              (typename GLONASS_SpaceNode<FloatT>::TimeProperties)(eph)),
+            deltaT_new - deltaT);
+        deltaT = deltaT_new;
+      }
+      return eph.constellation(t_tx, dt_transit);
+    }
+  };
+  mutable propagation_cache_t propagation_cache;
+  typename GPS_SpaceNode<FloatT>::SatelliteProperties::constellation_t constellation_cached(
+      const GPS_Time<FloatT> &t_tx, const FloatT &dt_transit = 0) const {
+    return propagation_cache.constellation(*this, t_tx, dt_transit);
+  }
+  
   unsigned char get_F_T_index() const {
     return GLONASS_Ephemeris<FloatT>::F_T_index();
   }
@@ -2480,8 +2852,36 @@ struct GPS_User_PVT
   typedef GPS_Solver_RAIM_LSR<FloatT, 
       GPS_Solver_Base_Debug<FloatT, GPS_Solver_Base<FloatT> > > solver_t;
   typedef typename solver_t::user_pvt_t base_t;
+  struct cache_t {
+    bool C_valid, S_valid, slope_HV_valid, slope_HV_enu_valid;
+    Matrix<FloatT, Array2D_Dense<FloatT> > C, S, slope_HV, slope_HV_enu;
+    cache_t()
+        : C_valid(false), S_valid(false), slope_HV_valid(false), slope_HV_enu_valid(false),
+        C(), S(), slope_HV(), slope_HV_enu() {}
+  };
+  /*
+   * C, S, and slopes, which are invariant for a solution, are calculated once.
+   * They are kept outside of the object, whose layout is the same as base_t,
+   * so that a temporary solution of the solver can be passed to a hook as GPS_User_PVT
+   * without copy; see GPS_Solver::update_position_solution().
+   * The entry is removed by the destructor, or release_cache() for such a view.
+   */
+  typedef std::map<const GPS_User_PVT *, cache_t> caches_t;
+  static caches_t &caches(){
+    static caches_t res;
+    return res;
+  }
+  cache_t &cache() const {return caches()[this];}
+  void release_cache() const {caches().erase(this);}
   GPS_User_PVT() : base_t() {}
   GPS_User_PVT(const base_t &base) : base_t(base) {}
+  GPS_User_PVT(const GPS_User_PVT &another) : base_t(another) {}
+  GPS_User_PVT &operator=(const GPS_User_PVT &another){
+    release_cache();
+    base_t::operator=(another);
+    return *this;
+  }
+  ~GPS_User_PVT(){release_cache();}
   enum {
     ERROR_NO = 0,
     ERROR_UNSOLVED,
@@ -2531,37 +2931,62 @@ struct GPS_User_PVT
     return typename proxy_t::linear_solver_t(base_t::G, base_t::W, base_t::delta_r)
         .partial(used_satellites());
   }
+  const Matrix<FloatT, Array2D_Dense<FloatT> > &C_cached() const {
+    cache_t &cache_(cache());
+    if(!cache_.C_valid){
+      cache_.C = linear_solver().C();
+      cache_.C_valid = true;
+    }
+    return cache_.C;
+  }
+  const Matrix<FloatT, Array2D_Dense<FloatT> > &S_cached() const {
+    cache_t &cache_(cache());
+    if(!cache_.S_valid){
+      linear_solver().least_square(cache_.S);
+      cache_.S_valid = true;
+    }
+    return cache_.S;
+  }
+  // Returning copy because cached matrices are shared with other accessors
   Matrix<FloatT, Array2D_Dense<FloatT> > C() const {
-    return linear_solver().C();
+    return C_cached().copy();
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > C_enu() const {
-    return proxy_t::linear_solver_t::rotate_CP(C(), base_t::user_position.ecef2enu());
+    return proxy_t::linear_solver_t::rotate_CP(C_cached(), base_t::user_position.ecef2enu());
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > S() const {
-    Matrix<FloatT, Array2D_Dense<FloatT> > res;
-    linear_solver().least_square(res);
-    return res;
+    return S_cached().copy();
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > S_enu(
       const Matrix<FloatT, Array2D_Dense<FloatT> > &s) const {
     return proxy_t::linear_solver_t::rotate_S(s, base_t::user_position.ecef2enu());
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > S_enu() const {
-    return S_enu(S());
+    return S_enu(S_cached());
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > slope_HV(
       const Matrix<FloatT, Array2D_Dense<FloatT> > &s) const {
     return linear_solver().slope_HV(s);
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > slope_HV() const {
-    return slope_HV(S());
+    cache_t &cache_(cache());
+    if(!cache_.slope_HV_valid){
+      cache_.slope_HV = slope_HV(S_cached());
+      cache_.slope_HV_valid = true;
+    }
+    return cache_.slope_HV.copy();
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > slope_HV_enu(
       const Matrix<FloatT, Array2D_Dense<FloatT> > &s) const {
     return linear_solver().slope_HV(s, base_t::user_position.ecef2enu());
   }
   Matrix<FloatT, Array2D_Dense<FloatT> > slope_HV_enu() const {
-    return slope_HV_enu(S());
+    cache_t &cache_(cache());
+    if(!cache_.slope_HV_enu_valid){
+      cache_.slope_HV_enu = slope_HV_enu(S_cached());
+      cache_.slope_HV_enu_valid = true;
+    }
+    return cache_.slope_HV_enu.copy();
   }
   
   void fd(const typename base_t::detection_t **out) const {*out = &(base_t::FD);}
@@ -2608,6 +3033,9 @@ struct GPS_Measurement {
 
     ITEMS_PREDEFINED,
   };
+  void clear(){
+    items.clear();
+  }
   void add(const int &prn, const int &key, const FloatT &value){
     items[prn][key] = value;
   }
@@ -2768,15 +3196,117 @@ struct GPS_Solver
     GLONASS_SpaceNode<FloatT> space_node;
     GLONASS_SolverOptions<FloatT> options;
     HookableSolver<GLONASS_SinglePositioning<FloatT>, GPS_Solver<FloatT> > solver;
-    glonass_t() : space_node(), options(), solver(space_node) {}
+    /*
+     * Position and velocity of a satellite selected with broadcast ephemeris are
+     * propagated from the checkpoint of GLONASS_Ephemeris::propagation_cache_t
+     * instead of integrating from t_b every time.
+     */
+    struct ephemeris_proxy_t {
+      typedef typename GLONASS_Ephemeris<FloatT>::eph_t eph_t;
+      struct item_t {
+        const void *impl;
+        typename base_t::satellite_t (*impl_select)(
+            const void *,
+            const typename base_t::prn_t &, const typename base_t::gps_time_t &);
+      } glonass, broadcast;
+      const GLONASS_SpaceNode<FloatT> &space_node;
+      struct checkpoint_t {
+        eph_t eph; // copy of the selected ephemeris
+        typename GLONASS_Ephemeris<FloatT>::propagation_cache_t cache;
+        checkpoint_t() : eph(), cache() {}
+        static typename base_t::xyz_t position(
+            const void *ptr,
+            const typename base_t::gps_time_t &t_tx, const typename base_t::float_t &dt_transit){
+          checkpoint_t &self(*static_cast<checkpoint_t *>(const_cast<void *>(ptr)));
+          return self.cache.constellation(self.eph, t_tx, dt_transit).position;
+        }
+        static typename base_t::xyz_t velocity(
+            const void *ptr,
+            const typename base_t::gps_time_t &t_tx, const typename base_t::float_t &dt_transit){
+          checkpoint_t &self(*static_cast<checkpoint_t *>(const_cast<void *>(ptr)));
+          return self.cache.constellation(self.eph, t_tx, dt_transit).velocity;
+        }
+      };
+      mutable checkpoint_t checkpoints[24];
+      static typename base_t::satellite_t forward(
+          const void *ptr,
+          const typename base_t::prn_t &prn, const typename base_t::gps_time_t &t){
+        const ephemeris_proxy_t *proxy(static_cast<const ephemeris_proxy_t *>(ptr));
+        typename base_t::satellite_t res(proxy->glonass.impl_select(proxy->glonass.impl, prn, t));
+        int slot(prn & 0xFF);
+        if((proxy->glonass.impl_select != proxy->broadcast.impl_select) // replaced, for example, by SP3
+            || (!res.is_available())
+            || (slot < 1) || (slot > 24)){
+          return res;
+        }
+        checkpoint_t &checkpoint(proxy->checkpoints[slot - 1]);
+        checkpoint.eph = const_cast<GLONASS_SpaceNode<FloatT> &>(proxy->space_node)
+            .satellite(slot).ephemeris(); // checkpoint is kept while the ephemeris is unchanged
+        res.impl_xyz = &checkpoint;
+        res.impl_position = checkpoint_t::position;
+        res.impl_velocity = checkpoint_t::velocity;
+        return res;
+      }
+      ephemeris_proxy_t(
+          GLONASS_SinglePositioning<FloatT> &solver, const GLONASS_SpaceNode<FloatT> &space_node_)
+          : space_node(space_node_) {
+        broadcast.impl = glonass.impl = solver.satellites.impl;
+        broadcast.impl_select = glonass.impl_select = solver.satellites.impl_select;
+        solver.satellites.impl = this;
+        solver.satellites.impl_select = forward;
+      }
+    } ephemeris_proxy;
+    glonass_t() : space_node(), options(), solver(space_node), ephemeris_proxy(solver, space_node) {}
   } glonass;
   VALUE hooks;
+  mutable solver_lock_t lock; // serializing tasks, see run()
   typedef std::vector<GPS_RangeCorrector<FloatT> > user_correctors_t;
   user_correctors_t user_correctors;
+  mutable bool hooks_suspended; // true during native-only calculation without GVL
+  mutable struct ephemeris_selection_t {
+    bool valid;
+    unsigned int generation; // ephemeris_generation() at the last selection
+    unsigned int generation_latest; // snapshot of ephemeris_generation() taken with GVL
+    GPS_Time<FloatT> t_updated, t_expired;
+  } ephemeris_selection; // to skip redundant update_all_ephemeris
+  struct options_ext_t {
+    bool tracking; // seed each epoch with the previous solution
+    int tracking_iteration_max; // limit of position iterations of a seeded epoch, 0 means unlimited
+    bool ekf; // recursive estimation with extended Kalman filter instead of snapshot LSR
+    FloatT ekf_q_acceleration; // PSD of user acceleration [m^2/s^3], per axis
+    FloatT ekf_q_clock; // PSD of receiver clock error [m^2/s]
+    FloatT ekf_q_clock_drift; // PSD of receiver clock error rate [m^2/s^3]
+  } options_ext;
+  struct options_t : public super_t::options_t, public options_ext_t {
+    options_t() : super_t::options_t(), options_ext_t() {}
+    options_t(const typename super_t::options_t &opt, const options_ext_t &opt_ext)
+        : super_t::options_t(opt), options_ext_t(opt_ext) {}
+  };
+  mutable struct tracking_state_t {
+    bool valid;
+    GPS_Time<FloatT> t;
+    typename base_t::xyz_t position, velocity;
+    FloatT receiver_error, receiver_error_rate;
+    int iteration_left; // remaining position iterations of the current epoch, negative means unlimited
+  } tracking_state; // previous solution to seed the next epoch in tracking mode
+  /**
+   * State of extended Kalman filter;
+   * x = [position(ECEF, 3), velocity(ECEF, 3), receiver_error, receiver_error_rate]
+   */
+  mutable struct ekf_state_t {
+    enum {X = 0, V = 3, B = 6, B_DOT = 7, SIZE = 8};
+    bool valid;
+    GPS_Time<FloatT> t;
+    FloatT x[SIZE], P[SIZE][SIZE];
+    struct linearized_t { // accepted range measurement
+      FloatT h[4], residual, sigma;
+    };
+  } ekf_state;
 
   static void mark(void *ptr){
     GPS_Solver<FloatT> *solver = (GPS_Solver<FloatT> *)ptr;
     rb_gc_mark(solver->hooks);
+    rb_gc_mark(solver->lock.mutex);
     for(typename user_correctors_t::const_iterator 
           it(solver->user_correctors.begin()), it_end(solver->user_correctors.end());
         it != it_end; ++it){
@@ -2786,9 +3316,28 @@ struct GPS_Solver
 
   GPS_Solver() : super_t(),
       gps(), sbas(), glonass(),
-      hooks(), user_correctors() {
+      hooks(), lock(), user_correctors(), hooks_suspended(false) {
+
+    ephemeris_selection.valid = false;
+    ephemeris_selection.generation = ephemeris_selection.generation_latest = 0;
+    options_ext.tracking = options_ext.ekf = false;
+    options_ext.tracking_iteration_max = 0;
+    options_ext.ekf_q_acceleration = 1; // 1 m/s^2 within 1 sec
+    options_ext.ekf_q_clock = 1E-2; // TCXO class
+    options_ext.ekf_q_clock_drift = 1E-1;
+    tracking_state.valid = false;
+    tracking_state.iteration_left = -1;
+    ekf_state.valid = false;
 
     hooks = rb_hash_new();
+    solver_lock_t::space_nodes()[&gps.space_node]
+        = solver_lock_t::space_nodes()[&sbas.space_node]
+        = solver_lock_t::space_nodes()[&glonass.space_node]
+        = &lock;
+    ephemeris_generation_t::space_nodes()[&gps.space_node]
+        = ephemeris_generation_t::space_nodes()[&sbas.space_node]
+        = ephemeris_generation_t::space_nodes()[&glonass.space_node]
+        = 0;
 
     typename base_t::range_correction_t ionospheric, tropospheric;
     ionospheric.push_back(&sbas.solver.ionospheric_sbas);
@@ -2807,12 +3356,39 @@ struct GPS_Solver
     sbas.solver.hook = this;
     glonass.solver.hook = this;
   }
+  ~GPS_Solver(){
+    solver_lock_t::space_nodes().erase(&gps.space_node);
+    solver_lock_t::space_nodes().erase(&sbas.space_node);
+    solver_lock_t::space_nodes().erase(&glonass.space_node);
+    ephemeris_generation_t::space_nodes().erase(&gps.space_node);
+    ephemeris_generation_t::space_nodes().erase(&sbas.space_node);
+    ephemeris_generation_t::space_nodes().erase(&glonass.space_node);
+  }
+  unsigned int ephemeris_generation() const {
+    // changed whenever the generation of any space node is incremented
+    return ephemeris_generation_t::get(&gps.space_node)
+        + ephemeris_generation_t::get(&sbas.space_node)
+        + ephemeris_generation_t::get(&glonass.space_node);
+  }
   GPS_SpaceNode<FloatT> &gps_space_node() {return gps.space_node;}
   GPS_SolverOptions<FloatT> &gps_options() {return gps.options;}
   SBAS_SpaceNode<FloatT> &sbas_space_node() {return sbas.space_node;}
   SBAS_SolverOptions<FloatT> &sbas_options() {return sbas.options;}
   GLONASS_SpaceNode<FloatT> &glonass_space_node() {return glonass.space_node;}
   GLONASS_SolverOptions<FloatT> &glonass_options() {return glonass.options;}
+  int read_rinex_nav(std::istream &in) {
+    // all space nodes are filled with a single parse of (possibly mixed) navigation file
+    typename RINEX_NAV_Reader<FloatT>::space_node_list_t space_nodes = {&gps.space_node};
+    space_nodes.qzss = &gps.space_node;
+    space_nodes.sbas = &sbas.space_node;
+    space_nodes.glonass = &glonass.space_node;
+    ephemeris_generation_t::increment(&gps.space_node);
+    ephemeris_generation_t::increment(&sbas.space_node);
+    ephemeris_generation_t::increment(&glonass.space_node);
+    rinex_nav_read_t<FloatT> task(in, space_nodes);
+    lock.run(task);
+    return task.res;
+  }
   const base_t &select(
       const typename base_t::prn_t &prn) const {
     if(prn > 0 && prn <= 32){return gps.solver;}
@@ -2854,17 +3430,591 @@ struct GPS_Solver
   virtual bool update_position_solution(
       const typename base_t::geometric_matrices_t &geomat,
       typename base_t::user_pvt_t &res) const;
-  GPS_User_PVT<FloatT> solve(
-      const GPS_Measurement<FloatT> &measurement,
-      const GPS_Time<FloatT> &receiver_time) const {
-    const_cast<gps_t &>(gps).space_node.update_all_ephemeris(receiver_time);
+  /**
+   * Time until which the selected ephemeris is continuously valid from t, which is
+   * searched with is_valid() in 1 sec resolution and limited by ephemeris_refresh_interval_max.
+   */
+  template <class EphemerisT>
+  static GPS_Time<FloatT> valid_until(const EphemerisT &eph, const GPS_Time<FloatT> &t){
+    FloatT lower(0), upper(1); // eph is valid at t + lower, and invalid at t + upper
+    while(eph.is_valid(t + upper)){
+      lower = upper;
+      if((upper *= 2) > ephemeris_refresh_interval_max){return t + ephemeris_refresh_interval_max;}
+    }
+    while((upper - lower) > 1){
+      FloatT mid((lower + upper) / 2);
+      (eph.is_valid(t + mid) ? lower : upper) = mid;
+    }
+    return t + lower;
+  }
+  template <class SpaceNodeT>
+  static void update_expiration(
+      const SpaceNodeT &space_node, const int &prn_min, const int &prn_max,
+      const GPS_Time<FloatT> &t, GPS_Time<FloatT> &t_expired){
+    for(int prn(prn_min); prn <= prn_max; ++prn){
+      if(!space_node.has_satellite(prn)){continue;}
+      if(!const_cast<SpaceNodeT &>(space_node).satellite(prn).ephemeris().is_valid(t)){continue;}
+      GPS_Time<FloatT> t_valid(valid_until(
+          const_cast<SpaceNodeT &>(space_node).satellite(prn).ephemeris(), t));
+      if(t_valid < t_expired){t_expired = t_valid;}
+    }
+  }
+  template <class EphemerisT>
+  static void append_bytes(std::string &buf, const EphemerisT &eph){
+    buf.append(reinterpret_cast<const char *>(&eph), sizeof(eph));
+  }
+  template <class SpaceNodeT>
+  static void append_selection(
+      std::string &buf, const SpaceNodeT &space_node, const int &prn_min, const int &prn_max){
+    for(int prn(prn_min); prn <= prn_max; ++prn){
+      if(!space_node.has_satellite(prn)){continue;}
+      append_bytes(buf, const_cast<SpaceNodeT &>(space_node).satellite(prn).ephemeris());
+    }
+  }
+  /**
+   * Select ephemeris of all space nodes at t, and return the selection as bytes to be compared.
+   */
+  std::string select_all_ephemeris(const GPS_Time<FloatT> &t) const {
+    const_cast<gps_t &>(gps).space_node.update_all_ephemeris(t);
+    const_cast<sbas_t &>(sbas).space_node.update_all_ephemeris(t);
+    const_cast<glonass_t &>(glonass).space_node.update_all_ephemeris(t);
+    std::string res;
+    append_selection(res, gps.space_node, 1, 32);
+    append_selection(res, gps.space_node, 193, 202); // QZSS
+    append_selection(res, sbas.space_node, 120, 158);
+    append_selection(res, glonass.space_node, 1, 24);
+    return res;
+  }
+  /**
+   * Select ephemeris for each satellite incrementally;
+   * selection is refreshed only when ephemeris is added (or reselected externally),
+   * time goes backward, or the selection would change.
+   * The selection is expected to be kept until any of the selected ephemerides expires.
+   * That is not assumed but verified by reselecting at the expiration time;
+   * if the result differs, for example, a newer ephemeris is preferred, the time when
+   * the selection changes is searched by bisection in 1 sec resolution.
+   * A satellite without valid ephemeris is reselected together with them.
+   */
+  void update_ephemeris(const GPS_Time<FloatT> &receiver_time) const {
+    ephemeris_selection_t &sel(ephemeris_selection);
+    if(sel.valid
+        && (sel.generation == sel.generation_latest)
+        && (!(receiver_time < sel.t_updated))
+        && (receiver_time < sel.t_expired)){
+      return;
+    }
+    std::string selected(select_all_ephemeris(receiver_time));
+    sel.valid = true;
+    sel.generation = sel.generation_latest;
+    sel.t_updated = receiver_time;
+    sel.t_expired = receiver_time + ephemeris_refresh_interval_max;
+    update_expiration(gps.space_node, 1, 32, receiver_time, sel.t_expired);
+    update_expiration(gps.space_node, 193, 202, receiver_time, sel.t_expired); // QZSS
+    update_expiration(sbas.space_node, 120, 158, receiver_time, sel.t_expired);
+    update_expiration(glonass.space_node, 1, 24, receiver_time, sel.t_expired);
+
+    FloatT lower(0), upper(sel.t_expired - receiver_time);
+    if((upper <= 0) || (select_all_ephemeris(sel.t_expired) == selected)){
+      if(upper > 0){select_all_ephemeris(receiver_time);} // restore selection
+      return;
+    }
+    // selection at receiver_time + lower is the same, and differs at receiver_time + upper
+    while((upper - lower) > 1){
+      FloatT mid((lower + upper) / 2);
+      ((select_all_ephemeris(receiver_time + mid) == selected) ? lower : upper) = mid;
+    }
+    sel.t_expired = receiver_time + lower;
+    select_all_ephemeris(receiver_time);
+  }
+  using super_t::update_options;
+  options_t available_options() const {
+    return options_t(super_t::available_options(), options_ext);
+  }
+  options_t update_options(const options_t &opt) {
+    options_ext = opt;
+    tracking_state.valid = false;
+    ekf_state.valid = false;
+    return options_t(super_t::update_options(opt), options_ext);
+  }
+  void update_options() const {
     const_cast<gps_t &>(gps).solver.update_options(gps.options);
-    const_cast<sbas_t &>(sbas).space_node.update_all_ephemeris(receiver_time);
     const_cast<sbas_t &>(sbas).solver.update_options(sbas.options);
-    const_cast<glonass_t &>(glonass).space_node.update_all_ephemeris(receiver_time);
     const_cast<glonass_t &>(glonass).solver.update_options(glonass.options);
-    return super_t::solve().user_pvt(measurement.items, receiver_time);
   }
+  /**
+   * Scalar measurement update of the extended Kalman filter,
+   * whose observation matrix row has non-zero elements h at idx.
+   * Residual is evaluated at the predicted state x_pred.
+   * @return false when the innovation is rejected by 5-sigma gate
+   */
+  static bool ekf_update(
+      ekf_state_t &ekf, const FloatT (&x_pred)[ekf_state_t::SIZE],
+      const int (&idx)[4], const FloatT (&h)[4],
+      const FloatT &residual, const FloatT &sigma){
+    static const int n(ekf_state_t::SIZE);
+    FloatT y(residual), PHt[n], S(sigma * sigma);
+    for(int k(0); k < 4; ++k){y -= h[k] * (ekf.x[idx[k]] - x_pred[idx[k]]);}
+    for(int i(0); i < n; ++i){
+      PHt[i] = 0;
+      for(int k(0); k < 4; ++k){PHt[i] += ekf.P[i][idx[k]] * h[k];}
+    }
+    for(int k(0); k < 4; ++k){S += h[k] * PHt[idx[k]];}
+    if((y * y) > (S * 25)){return false;}
+    for(int i(0); i < n; ++i){
+      ekf.x[i] += PHt[i] * y / S;
+      for(int j(0); j < n; ++j){ekf.P[i][j] -= PHt[i] * PHt[j] / S;}
+    }
+    return true;
+  }
+  /**
+   * Recursive estimation with extended Kalman filter.
+   * Residuals of relative_property() are linearized once at the predicted state,
+   * and processed sequentially as scalar measurements without matrix inversion.
+   * The filter is (re)initialized with the snapshot LSR solution at the first epoch,
+   * after time goes backward or ekf_max_gap, or when less than 4 ranges are accepted.
+   * Geometric matrices (G, W, delta_r) of the filtered results consist of the accepted ranges
+   * linearized at the predicted state, with residuals evaluated at the updated state,
+   * and DOP is calculated with the G.
+   * The update_position_solution hook is not supported, because no position iteration exists.
+   */
+  GPS_User_PVT<FloatT> solve_ekf(
+      const GPS_Measurement<FloatT> &measurement,
+      const GPS_Time<FloatT> &receiver_time) const {
+    typedef ekf_state_t s_t;
+    typedef typename base_t::xyz_t xyz_t;
+    s_t &ekf(ekf_state);
+    FloatT dt(ekf.valid ? (receiver_time - ekf.t) : ekf_max_gap);
+
+    if((dt < 0) || (dt >= ekf_max_gap)){ // (re)initialization
+      typename base_t::user_pvt_t res(
+          super_t::solve().user_pvt(measurement.items, receiver_time));
+      if(!(ekf.valid = res.position_solved())){return res;}
+      ekf.t = receiver_time;
+      bool vel_solved(res.velocity_solved());
+      xyz_t vel(vel_solved ? res.user_velocity : xyz_t());
+      FloatT x[] = {
+        res.user_position.xyz.x(), res.user_position.xyz.y(), res.user_position.xyz.z(),
+        vel.x(), vel.y(), vel.z(),
+        res.receiver_error, (vel_solved ? res.receiver_error_rate : 0)};
+      FloatT sigma[] = { // initial uncertainty [m], [m/s]
+        10, 10, 10,
+        (vel_solved ? 1 : 100), (vel_solved ? 1 : 100), (vel_solved ? 1 : 100),
+        10, (vel_solved ? 1 : 100)};
+      for(int i(0); i < s_t::SIZE; ++i){
+        ekf.x[i] = x[i];
+        for(int j(0); j < s_t::SIZE; ++j){ekf.P[i][j] = 0;}
+        ekf.P[i][i] = sigma[i] * sigma[i];
+      }
+      return res;
+    }
+
+    { // time update; x = F x, P = F P F^T + Q
+      static const int pairs[][2] = { // (i, j) such that F(i, j) = dt
+        {s_t::X, s_t::V}, {s_t::X + 1, s_t::V + 1}, {s_t::X + 2, s_t::V + 2},
+        {s_t::B, s_t::B_DOT}};
+      for(std::size_t k(0); k < sizeof(pairs) / sizeof(pairs[0]); ++k){
+        int i(pairs[k][0]), j(pairs[k][1]);
+        ekf.x[i] += ekf.x[j] * dt;
+        for(int l(0); l < s_t::SIZE; ++l){ekf.P[i][l] += ekf.P[j][l] * dt;}
+      }
+      for(std::size_t k(0); k < sizeof(pairs) / sizeof(pairs[0]); ++k){
+        int i(pairs[k][0]), j(pairs[k][1]);
+        for(int l(0); l < s_t::SIZE; ++l){ekf.P[l][i] += ekf.P[l][j] * dt;}
+      }
+      FloatT dt2(dt * dt), dt3(dt2 * dt);
+      const FloatT &q_a(options_ext.ekf_q_acceleration);
+      for(int k(0); k < 3; ++k){
+        ekf.P[s_t::X + k][s_t::X + k] += q_a * dt3 / 3;
+        ekf.P[s_t::X + k][s_t::V + k] += q_a * dt2 / 2;
+        ekf.P[s_t::V + k][s_t::X + k] += q_a * dt2 / 2;
+        ekf.P[s_t::V + k][s_t::V + k] += q_a * dt;
+      }
+      const FloatT &q_b(options_ext.ekf_q_clock), &q_d(options_ext.ekf_q_clock_drift);
+      ekf.P[s_t::B][s_t::B] += q_b * dt + q_d * dt3 / 3;
+      ekf.P[s_t::B][s_t::B_DOT] += q_d * dt2 / 2;
+      ekf.P[s_t::B_DOT][s_t::B] += q_d * dt2 / 2;
+      ekf.P[s_t::B_DOT][s_t::B_DOT] += q_d * dt;
+    }
+
+    // measurement update
+    FloatT x_pred[s_t::SIZE];
+    std::copy(ekf.x, ekf.x + s_t::SIZE, x_pred);
+    typename base_t::pos_t pos_pred(xyz_t(x_pred[s_t::X], x_pred[s_t::X + 1], x_pred[s_t::X + 2]));
+    typename base_t::gps_time_t t_arrival(
+        receiver_time - (x_pred[s_t::B] / GPS_SpaceNode<FloatT>::light_speed));
+    typename base_t::user_pvt_t res;
+    res.receiver_time = receiver_time;
+    res.used_satellites = 0;
+    typedef typename s_t::linearized_t linearized_t;
+    std::vector<linearized_t> accepted; // for geometric matrices
+    const typename base_t::measurement_t &items(measurement.items);
+    for(typename base_t::measurement_t::const_iterator it(items.begin()), it_end(items.end());
+        it != it_end; ++it){
+      typename base_t::relative_property_t prop(relative_property(
+          it->first, it->second, x_pred[s_t::B], t_arrival,
+          pos_pred, xyz_t())); // zero velocity to obtain the rate residual linear to the state
+      if(!(prop.range_sigma > 0)){continue;}
+      const FloatT h[] = {prop.los_neg[0], prop.los_neg[1], prop.los_neg[2], 1};
+      static const int idx_range[] = {s_t::X, s_t::X + 1, s_t::X + 2, s_t::B};
+      if(!ekf_update(ekf, x_pred, idx_range, h, prop.range_residual, prop.range_sigma)){continue;}
+      ++res.used_satellites;
+      res.used_satellite_mask.set(it->first);
+      linearized_t lin = {{h[0], h[1], h[2], h[3]}, prop.range_residual, prop.range_sigma};
+      accepted.push_back(lin);
+      if(!(prop.rate_sigma > 0)){continue;}
+      static const int idx_rate[] = {s_t::V, s_t::V + 1, s_t::V + 2, s_t::B_DOT};
+      FloatT rate_residual(prop.rate_relative_neg);
+      for(int k(0); k < 4; ++k){rate_residual -= h[k] * x_pred[idx_rate[k]];}
+      ekf_update(ekf, x_pred, idx_rate, h, rate_residual, prop.rate_sigma);
+    }
+    if(res.used_satellites < 4){ // lost track, then restart with snapshot solution
+      ekf.valid = false;
+      return solve_ekf(measurement, receiver_time);
+    }
+    ekf.t = receiver_time;
+
+    { // geometric matrices in ascending PRN order, the same as used_satellite_mask
+      static const int idx_range[] = {s_t::X, s_t::X + 1, s_t::X + 2, s_t::B};
+      const unsigned int n(accepted.size());
+      Matrix<FloatT, Array2D_Dense<FloatT> > G(n, 4), W(n, n), delta_r(n, 1);
+      for(unsigned int i(0); i < n; ++i){
+        const linearized_t &lin(accepted[i]);
+        FloatT residual(lin.residual);
+        for(int k(0); k < 4; ++k){
+          G(i, k) = lin.h[k];
+          residual -= lin.h[k] * (ekf.x[idx_range[k]] - x_pred[idx_range[k]]);
+        }
+        for(unsigned int j(0); j < n; ++j){W(i, j) = 0;}
+        W(i, i) = 1. / (lin.sigma * lin.sigma);
+        delta_r(i, 0) = residual;
+      }
+      res.G = G;
+      res.W = W;
+      res.delta_r = delta_r;
+    }
+
+    res.user_position = typename base_t::pos_t(
+        xyz_t(ekf.x[s_t::X], ekf.x[s_t::X + 1], ekf.x[s_t::X + 2]));
+    res.receiver_error = ekf.x[s_t::B];
+    res.user_velocity = xyz_t(ekf.x[s_t::V], ekf.x[s_t::V + 1], ekf.x[s_t::V + 2]);
+    res.user_velocity_enu = typename base_t::enu_t::relative_rel(
+        res.user_velocity, res.user_position.llh);
+    res.receiver_error_rate = ekf.x[s_t::B_DOT];
+    { // standard deviations from covariance
+      FloatT lat(res.user_position.llh.latitude()), lng(res.user_position.llh.longitude());
+      FloatT enu[3][3] = {
+        {-std::sin(lng), std::cos(lng), 0},
+        {-std::sin(lat) * std::cos(lng), -std::sin(lat) * std::sin(lng), std::cos(lat)},
+        {std::cos(lat) * std::cos(lng), std::cos(lat) * std::sin(lng), std::sin(lat)}};
+      FloatT var_enu[3] = {0}, var_vel(0);
+      for(int k(0); k < 3; ++k){
+        for(int i(0); i < 3; ++i){
+          for(int j(0); j < 3; ++j){
+            var_enu[k] += enu[k][i] * ekf.P[s_t::X + i][s_t::X + j] * enu[k][j];
+          }
+        }
+        var_vel += ekf.P[s_t::V + k][s_t::V + k];
+      }
+      res.sigma_pos.h = std::sqrt(var_enu[0] + var_enu[1]);
+      res.sigma_pos.v = std::sqrt(var_enu[2]);
+      res.sigma_pos.t = std::sqrt(ekf.P[s_t::B][s_t::B]);
+      res.sigma_vel.p = std::sqrt(var_vel);
+
+      // DOP of the accepted ranges, the same as that of snapshot solution with G
+      FloatT A[4][4] = {{0}}, dop[5];
+      for(typename std::vector<linearized_t>::const_iterator
+            it(accepted.begin()), it_end(accepted.end());
+          it != it_end; ++it){
+        FloatT g[4] = {0, 0, 0, it->h[3]};
+        for(int i(0); i < 3; ++i){
+          for(int j(0); j < 3; ++j){g[i] += enu[i][j] * it->h[j];}
+        }
+        for(int i(0); i < 4; ++i){
+          for(int j(0); j <= i; ++j){A[i][j] += g[i] * g[j];}
+        }
+      }
+      for(int i(0); i < 5; ++i){dop[i] = std::numeric_limits<FloatT>::quiet_NaN();}
+      dop_normal(A, dop);
+      res.dop.g = dop[0];
+      res.dop.p = dop[1];
+      res.dop.h = dop[2];
+      res.dop.v = dop[3];
+      res.dop.t = dop[4];
+    }
+    res.error_code = base_t::user_pvt_t::ERROR_NO;
+    return res;
+  }
+  GPS_User_PVT<FloatT> solve_prepared(
+      const GPS_Measurement<FloatT> &measurement,
+      const GPS_Time<FloatT> &receiver_time) const {
+    // update_ephemeris() and update_options() must be called in advance
+    tracking_state.iteration_left = -1; // unlimited unless seeded
+    if(options_ext.ekf){
+      if((!hooks_suspended) // with GVL
+          && !NIL_P(rb_hash_lookup(hooks, ID2SYM(rb_intern("update_position_solution"))))){
+        throw std::runtime_error("update_position_solution hook is unavailable in EKF mode");
+      }
+      return solve_ekf(measurement, receiver_time);
+    }
+    tracking_state_t &track(tracking_state);
+    if(!options_ext.tracking){
+      return super_t::solve().user_pvt(measurement.items, receiver_time);
+    }
+    FloatT dt(track.valid ? (receiver_time - track.t) : tracking_max_gap);
+    bool seeded(std::abs(dt) < tracking_max_gap);
+    if(seeded && (options_ext.tracking_iteration_max > 0)){
+      track.iteration_left = options_ext.tracking_iteration_max; // see update_position_solution()
+    }
+    typename base_t::user_pvt_t res(seeded
+        ? super_t::solve().user_pvt(measurement.items, receiver_time,
+          typename base_t::xyz_t( // previous solution propagated with its velocity
+            track.position.x() + track.velocity.x() * dt,
+            track.position.y() + track.velocity.y() * dt,
+            track.position.z() + track.velocity.z() * dt),
+          track.receiver_error + track.receiver_error_rate * dt)
+        : super_t::solve().user_pvt(measurement.items, receiver_time));
+    track.iteration_left = -1;
+    if((track.valid = res.position_solved())){
+      track.t = receiver_time;
+      track.position = res.user_position.xyz;
+      track.receiver_error = res.receiver_error;
+      if(res.velocity_solved()){
+        track.velocity = res.user_velocity;
+        track.receiver_error_rate = res.receiver_error_rate;
+      }else{
+        track.velocity = typename base_t::xyz_t();
+        track.receiver_error_rate = 0;
+      }
+    }
+    return res;
+  }
+  bool is_hook_free() const {
+    return (RHASH_SIZE(hooks) == 0) && user_correctors.empty();
+  }
+  /**
+   * Unit of work for run().
+   * A task may return before its end when canceled; it must then be able to resume
+   * from where it stopped by the next call, and set done only when it has finished.
+   */
+  struct task_t {
+    bool done;
+    task_t() : done(false) {}
+    virtual ~task_t() {}
+    virtual void operator()(const volatile bool &canceled) = 0;
+  };
+  /**
+   * Run task exclusively to the other tasks of this solver and to the mutators of
+   * its space nodes, because GVL no longer serializes them while a task runs without GVL.
+   * The states of solver (tracking, EKF, and ephemeris selection) are mutated in a task,
+   * and its inputs are copied in advance.
+   */
+  void run(task_t &task) const {
+    struct locked_t : public solver_lock_t::task_t {
+      const GPS_Solver<FloatT> &solver;
+      typename GPS_Solver<FloatT>::task_t &task;
+      locked_t(const GPS_Solver<FloatT> &solver_, typename GPS_Solver<FloatT>::task_t &task_)
+          : solver_lock_t::task_t(), solver(solver_), task(task_) {}
+      void operator()(){solver.run_locked(task);}
+    } locked(*this, task);
+    lock.run(locked);
+  }
+  /**
+   * Run task with releasing GVL when neither hooks nor user defined correctors are
+   * installed, which means no Ruby code is invoked during the task.
+   * Otherwise, the task runs with GVL as usual.
+   * The task is resumed after an interruption such as Thread#wakeup or a trapped signal
+   * until it finishes, unless the interruption raises an exception.
+   */
+  void run_locked(task_t &task) const {
+    ephemeris_selection.generation_latest = ephemeris_generation();
+    if(!is_hook_free()){
+      volatile bool canceled(false);
+      task(canceled);
+      return;
+    }
+    run_without_gvl(task, &hooks_suspended);
+  }
+  /**
+   * Run task without GVL, which must not call Ruby, resuming it after interruptions.
+   * @param suspended if given, it is set to true only while GVL is released.
+   */
+  static void run_without_gvl(task_t &task, bool *suspended = NULL){
+    struct arg_t {
+      task_t &task;
+      volatile bool canceled;
+      enum {ERROR_NONE, ERROR_INVALID_ARGUMENT, ERROR_RUNTIME} error;
+      std::string message;
+      static void *run(void *ptr){
+        arg_t *arg(static_cast<arg_t *>(ptr));
+        try{
+          (arg->task)(arg->canceled);
+        }catch(std::invalid_argument &e){
+          arg->error = ERROR_INVALID_ARGUMENT;
+          arg->message = e.what();
+        }catch(std::exception &e){
+          arg->error = ERROR_RUNTIME;
+          arg->message = e.what();
+        }
+        return NULL;
+      }
+      static void cancel(void *ptr){
+        static_cast<arg_t *>(ptr)->canceled = true;
+      }
+      static VALUE check_ints(VALUE v){
+        rb_thread_check_ints();
+        return Qnil;
+      }
+    } arg = {task, false, arg_t::ERROR_NONE, std::string()};
+    while(true){
+      arg.canceled = false;
+      if(suspended){*suspended = true;}
+      rb_thread_call_without_gvl(arg_t::run, &arg, arg_t::cancel, &arg);
+      if(suspended){*suspended = false;}
+      switch(arg.error){
+        case arg_t::ERROR_INVALID_ARGUMENT: throw std::invalid_argument(arg.message);
+        case arg_t::ERROR_RUNTIME: throw std::runtime_error(arg.message);
+        default: break;
+      }
+      if(task.done){break;}
+      int state(0);
+      rb_protect(arg_t::check_ints, Qnil, &state); // raise pending interrupt if any
+      if(state != 0){throw native_exception(state);}
+    }
+  }
+  /**
+   * DOP-only geometry from a receiver to satellites, both of which are given in ECEF.
+   * The geometry is evaluated in GeometryT, which can be float for bulk map generation
+   * or long double for reference, while the differences of positions are taken in FloatT.
+   *
+   * @param res GDOP, PDOP, HDOP, VDOP, and TDOP; NaN if less than 4 satellites are visible
+   */
+  template <class GeometryT>
+  static void dop_geometry(
+      const FloatT *receiver, const FloatT *satellites, const std::size_t &satellites_len,
+      const FloatT &elevation_mask, FloatT (&res)[5]){
+    for(int i(0); i < 5; ++i){res[i] = std::numeric_limits<FloatT>::quiet_NaN();}
+    typename base_t::pos_t pos((typename base_t::xyz_t(receiver[0], receiver[1], receiver[2])));
+    const GeometryT lat(pos.llh.latitude()), lng(pos.llh.longitude());
+    const GeometryT enu[3][3] = {
+      {-std::sin(lng), std::cos(lng), 0},
+      {-std::sin(lat) * std::cos(lng), -std::sin(lat) * std::sin(lng), std::cos(lat)},
+      {std::cos(lat) * std::cos(lng), std::cos(lat) * std::sin(lng), std::sin(lat)}};
+    const GeometryT sin_mask(std::sin((GeometryT)elevation_mask));
+    GeometryT A[4][4] = {{0}}; // lower part of G^{T} G, where G is in ENU
+    unsigned int visible(0);
+    for(std::size_t k(0); k < satellites_len; ++k, satellites += 3){
+      GeometryT los[3], range(0);
+      for(int i(0); i < 3; ++i){
+        los[i] = (GeometryT)(satellites[i] - receiver[i]);
+        range += los[i] * los[i];
+      }
+      if(!(range > 0)){continue;}
+      range = std::sqrt(range);
+      GeometryT g[4] = {0, 0, 0, 1}; // direction from satellite to receiver, and clock
+      for(int i(0); i < 3; ++i){
+        for(int j(0); j < 3; ++j){g[i] -= enu[i][j] * los[j];}
+        g[i] /= range;
+      }
+      if(-g[2] < sin_mask){continue;}
+      ++visible;
+      for(int i(0); i < 4; ++i){
+        for(int j(0); j <= i; ++j){A[i][j] += g[i] * g[j];}
+      }
+    }
+    if(visible < 4){return;}
+    dop_normal(A, res);
+  }
+  /**
+   * DOP from the lower part of the normal matrix G^{T} G, where G is in ENU.
+   *
+   * @param res GDOP, PDOP, HDOP, VDOP, and TDOP; unchanged if singular
+   */
+  template <class GeometryT>
+  static void dop_normal(const GeometryT (&A)[4][4], FloatT (&res)[5]){
+    GeometryT L[4][4] = {{0}}, L_inv[4][4] = {{0}}; // Cholesky factor, and its inverse
+    for(int i(0); i < 4; ++i){
+      for(int j(0); j <= i; ++j){
+        GeometryT v(A[i][j]);
+        for(int k(0); k < j; ++k){v -= L[i][k] * L[j][k];}
+        if(i != j){
+          L[i][j] = v / L[j][j];
+        }else if(v > 0){
+          L[i][i] = std::sqrt(v);
+        }else{
+          return; // singular
+        }
+      }
+    }
+    for(int i(0); i < 4; ++i){
+      L_inv[i][i] = 1 / L[i][i];
+      for(int j(0); j < i; ++j){
+        GeometryT v(0);
+        for(int k(j); k < i; ++k){v -= L[i][k] * L_inv[k][j];}
+        L_inv[i][j] = v / L[i][i];
+      }
+    }
+    GeometryT q[4] = {0}; // diagonal of (G^{T} G)^{-1} = L^{-T} L^{-1}
+    for(int i(0); i < 4; ++i){
+      for(int k(i); k < 4; ++k){q[i] += L_inv[k][i] * L_inv[k][i];}
+    }
+    res[0] = (FloatT)std::sqrt(q[0] + q[1] + q[2] + q[3]);
+    res[1] = (FloatT)std::sqrt(q[0] + q[1] + q[2]);
+    res[2] = (FloatT)std::sqrt(q[0] + q[1]);
+    res[3] = (FloatT)std::sqrt(q[2]);
+    res[4] = (FloatT)std::sqrt(q[3]);
+  }
+  GPS_User_PVT<FloatT> solve(
+      const GPS_Measurement<FloatT> &measurement,
+      const GPS_Time<FloatT> &receiver_time) const {
+    struct solve_t : public task_t {
+      const GPS_Solver<FloatT> &solver;
+      const GPS_Measurement<FloatT> measurement; // copied not to be modified during the task
+      const GPS_Time<FloatT> receiver_time;
+      GPS_User_PVT<FloatT> res;
+      solve_t(
+          const GPS_Solver<FloatT> &solver_,
+          const GPS_Measurement<FloatT> &measurement_,
+          const GPS_Time<FloatT> &receiver_time_)
+          : task_t(), solver(solver_),
+          measurement(measurement_), receiver_time(receiver_time_), res() {}
+      void operator()(const volatile bool &canceled){
+        solver.update_ephemeris(receiver_time);
+        solver.update_options();
+        res = solver.solve_prepared(measurement, receiver_time);
+        task_t::done = true;
+      }
+    } task(*this, measurement, receiver_time);
+    run(task);
+    return task.res;
+  }
+  /**
+   * Maximum interval [s] to refresh ephemeris selection,
+   * which is applied to ephemeris having (practically) unlimited validity such as QZSS.
+   */
+  static const FloatT ephemeris_refresh_interval_max;
+  /**
+   * Maximum interval [s] between epochs to seed the solution with the previous one
+   * in tracking mode. Seeded by a close initial guess, which is regarded as good,
+   * the position iteration usually converges within 1-2 steps,
+   * and it can be limited by options_ext_t::tracking_iteration_max.
+   */
+  static const FloatT tracking_max_gap;
+  /**
+   * Maximum interval [s] between epochs to continue the Kalman filter without reinitialization.
+   */
+  static const FloatT ekf_max_gap;
+  struct batch_t {
+    const GPS_Solver<FloatT> &solver;
+    batch_t(const GPS_Solver<FloatT> &solver_) : solver(solver_) {
+      solver.update_options();
+    }
+    GPS_User_PVT<FloatT> solve(
+        const GPS_Measurement<FloatT> &measurement,
+        const GPS_Time<FloatT> &receiver_time) {
+      solver.update_ephemeris(receiver_time);
+      return solver.solve_prepared(measurement, receiver_time);
+    }
+  };
   typedef 
       std::map<int, std::vector<const typename base_t::range_corrector_t *> >
       range_correction_list_t;
@@ -2916,6 +4066,13 @@ struct GPS_Solver
   VALUE update_correction(const bool &update, const VALUE &hash);
 };
 
+template <class FloatT>
+const FloatT GPS_Solver<FloatT>::ephemeris_refresh_interval_max = 60 * 60 * 24;
+template <class FloatT>
+const FloatT GPS_Solver<FloatT>::tracking_max_gap = 60;
+template <class FloatT>
+const FloatT GPS_Solver<FloatT>::ekf_max_gap = 60;
+
 
 #include <limits.h>
 #if !defined(SWIG_NO_LLONG_MAX)
@@ -2982,7 +4139,137 @@ SWIG_From_char  (char c)
 
 
 template <class FloatT>
-struct RINEX_Observation {};
+struct RINEX_Observation {
+  /**
+   * Conversion of RINEX observation into GPS_Measurement items,
+   * whose observation type to measurement key mapping is resolved once from header.
+   */
+  struct measurement_mapper_t {
+    struct item_t {
+      int index; // index in observation types of each system
+      int key;
+      int key_ambiguity_scale; // negative when not carrier phase
+    };
+    typedef std::map<char, std::vector<item_t> > items_t;
+    items_t items;
+    std::map<int, FloatT> glonass_freq; // PRN => L1 frequency, described in header
+
+    static int key_of(const std::string &type_){
+      static const int keys[][5] = { // C, L, D, S, ambiguity scale
+        {GPS_Measurement<FloatT>::L1_PSEUDORANGE, GPS_Measurement<FloatT>::L1_CARRIER_PHASE,
+          GPS_Measurement<FloatT>::L1_DOPPLER, GPS_Measurement<FloatT>::L1_SIGNAL_STRENGTH_dBHz,
+          GPS_Measurement<FloatT>::L1_CARRIER_PHASE_AMBIGUITY_SCALE},
+        {GPS_Measurement<FloatT>::L2CL_PSEUDORANGE, GPS_Measurement<FloatT>::L2CL_CARRIER_PHASE,
+          GPS_Measurement<FloatT>::L2CL_DOPPLER, GPS_Measurement<FloatT>::L2CL_SIGNAL_STRENGTH_dBHz,
+          GPS_Measurement<FloatT>::L2CL_CARRIER_PHASE_AMBIGUITY_SCALE},
+        {GPS_Measurement<FloatT>::L2CM_PSEUDORANGE, GPS_Measurement<FloatT>::L2CM_CARRIER_PHASE,
+          GPS_Measurement<FloatT>::L2CM_DOPPLER, GPS_Measurement<FloatT>::L2CM_SIGNAL_STRENGTH_dBHz,
+          GPS_Measurement<FloatT>::L2CM_CARRIER_PHASE_AMBIGUITY_SCALE},
+      };
+      if(type_.size() < 2){return -1;}
+      int sig;
+      std::string sig_str(type_.substr(1));
+      if((sig_str == "1") || (sig_str == "1C")){sig = 0;}
+      else if((sig_str == "2X") || (sig_str == "2L")){sig = 1;}
+      else if(sig_str == "2S"){sig = 2;}
+      else{return -1;}
+      switch(type_[0]){
+        case 'C': return keys[sig][0];
+        case 'L': return keys[sig][1];
+        case 'D': return keys[sig][2];
+        case 'S': return keys[sig][3];
+        case 'A': return keys[sig][4]; // pseudo type for ambiguity scale
+      }
+      return -1;
+    }
+    static int prn_offset(const char &sys){
+      switch(sys){
+        case 'G': case ' ': return 0;
+        case 'S': return 100;
+        case 'J': return 192;
+        case 'R': return 0x100;
+      }
+      return -1;
+    }
+
+    template <class HeaderT, class ObsTypesT>
+    measurement_mapper_t(const HeaderT &header, const ObsTypesT &obs_types)
+        : items(), glonass_freq() {
+      for(typename ObsTypesT::const_iterator it(obs_types.begin()), it_end(obs_types.end());
+          it != it_end; ++it){
+        std::vector<item_t> &items_per_sys(items[it->first]);
+        int i(0);
+        for(typename ObsTypesT::mapped_type::const_iterator
+              it2(it->second.begin()), it2_end(it->second.end());
+            it2 != it2_end; ++it2, ++i){
+          int key(key_of(*it2));
+          if(key < 0){continue;}
+          item_t item = {i, key,
+              ((*it2)[0] == 'L') ? key_of(std::string("A").append(it2->substr(1))) : -1};
+          items_per_sys.push_back(item);
+        }
+      }
+      typename HeaderT::const_iterator it(header.find("GLONASS SLOT / FRQ #"));
+      if(it == header.end()){return;}
+      for(typename HeaderT::mapped_type::const_iterator
+            it2(it->second.begin()), it2_end(it->second.end());
+          it2 != it2_end; ++it2){
+        // "nnn Rnn ch Rnn ch ..." where each slot occupies 7 columns
+        for(std::string::size_type pos(4); pos + 6 <= it2->size(); pos += 7){
+          if((*it2)[pos] != 'R'){continue;}
+          int prn(std::atoi(it2->substr(pos + 1, 2).c_str())),
+              ch(std::atoi(it2->substr(pos + 4, 2).c_str()));
+          if(prn <= 0){continue;}
+          glonass_freq[prn] = GLONASS_SpaceNode<FloatT>::L1_frequency(ch);
+        }
+      }
+    }
+
+    /**
+     * @param sink object having add(prn, key, value)
+     * @param glonass_freq_missing GLONASS satellites (PRN with offset)
+     * whose frequency is not described in header; they should be resolved with ephemeris.
+     */
+    template <class ReaderT, class ObsT, class SinkT>
+    void convert(const ObsT &obs, SinkT &sink, std::vector<int> &glonass_freq_missing) const {
+      glonass_freq_missing.clear();
+      typename items_t::const_iterator it_default(items.find(' '));
+      for(typename ObsT::per_satellite_t::const_iterator
+            it(obs.per_satellite.begin()), it_end(obs.per_satellite.end());
+          it != it_end; ++it){
+        int prn;
+        char sys(ReaderT::serial2sys(it->first, prn));
+        int offset(prn_offset(sys));
+        if(offset < 0){continue;}
+        if(sys == 'R'){
+          typename std::map<int, FloatT>::const_iterator it_freq(glonass_freq.find(prn));
+          if(it_freq != glonass_freq.end()){
+            sink.add(prn + offset, GPS_Measurement<FloatT>::L1_FREQUENCY, it_freq->second);
+          }else{
+            glonass_freq_missing.push_back(prn + offset);
+          }
+        }
+        prn += offset;
+        typename items_t::const_iterator it_items(items.find(sys));
+        if(it_items == items.end()){
+          if(it_default == items.end()){continue;}
+          it_items = it_default;
+        }
+        for(typename std::vector<item_t>::const_iterator
+              it2(it_items->second.begin()), it2_end(it_items->second.end());
+            it2 != it2_end; ++it2){
+          if(it2->index >= (int)it->second.size()){continue;}
+          const typename ObsT::per_satellite_t::mapped_type::value_type &v(it->second[it2->index]);
+          if(!v.valid){continue;}
+          sink.add(prn, it2->key, v.value);
+          if((it2->key_ambiguity_scale >= 0) && ((v.lli & 0x2) == 0x2)){
+            sink.add(prn, it2->key_ambiguity_scale, 0.5);
+          }
+        }
+      }
+    }
+  };
+};
 
 
 struct PushableData {
@@ -3009,7 +4296,7 @@ struct PushableData {
             solver.gps.ephemeris_proxy.qzss, DataT::SYSTEM_QZSS);
       case SYS_GLONASS:
         return data.push(
-            solver.glonass.solver.satellites, DataT::SYSTEM_GLONASS);
+            solver.glonass.ephemeris_proxy.glonass, DataT::SYSTEM_GLONASS);
       case SYS_GALILEO:
       case SYS_BEIDOU:
       default:
@@ -3037,9 +4324,8 @@ struct PushableData {
 
 template <class FloatT>
 struct SP3 : public SP3_Product<FloatT>, PushableData {
-  int read(const char *fname) {
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
-    return SP3_Reader<FloatT>::read_all(fin, *this);
+  int read(std::istream &in) {
+    return SP3_Reader<FloatT>::read_all(in, *this);
   }
   typename SP3_Product<FloatT>::satellite_count_t satellites() const {
     return SP3_Product<FloatT>::satellite_count();
@@ -3066,10 +4352,9 @@ struct SP3 : public SP3_Product<FloatT>, PushableData {
       const int &sat_id, const GPS_Time<FloatT> &t) const {
     return SP3_Product<FloatT>::select(sat_id, t).clock_error_dot(t);
   }
-  int apply_antex(const char *fname) {
+  int apply_antex(std::istream &in) {
     ANTEX_Product<FloatT> antex;
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
-    int read_items(ANTEX_Reader<FloatT>::read_all(fin, antex));
+    int read_items(ANTEX_Reader<FloatT>::read_all(in, antex));
     if(read_items < 0){return read_items;}
     return antex.move_to_antenna_position(*this);
   }
@@ -3079,9 +4364,8 @@ struct SP3 : public SP3_Product<FloatT>, PushableData {
 template <class FloatT>
 struct RINEX_Clock : public RINEX_CLK<FloatT>::satellites_t, PushableData {
   typedef typename RINEX_CLK<FloatT>::satellites_t super_t;
-  int read(const char *fname) {
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
-    return RINEX_CLK_Reader<FloatT>::read_all(fin, *this);
+  int read(std::istream &in) {
+    return RINEX_CLK_Reader<FloatT>::read_all(in, *this);
   }
   typename RINEX_CLK<FloatT>::satellites_t::count_t satellites() const {
     return RINEX_CLK<FloatT>::satellites_t::count();
@@ -3637,7 +4921,9 @@ namespace swig {
 }
 
 SWIGINTERN void GPS_SpaceNode_Sl_double_Sg__register_ephemeris__SWIG_0(GPS_SpaceNode< double > *self,int const &prn,GPS_Ephemeris< double > const &eph,int const &priority_delta=1){
+    solver_lock_t::wait(self);
     self->satellite(prn).register_ephemeris(eph, priority_delta);
+    ephemeris_generation_t::increment(self);
   }
 SWIGINTERN GPS_Ephemeris< double > GPS_SpaceNode_Sl_double_Sg__ephemeris(GPS_SpaceNode< double > const *self,int const &prn){
     return GPS_Ephemeris<double>(
@@ -3680,11 +4966,13 @@ SWIG_AsCharPtrAndSize(VALUE obj, char** cptr, size_t* psize, int *alloc)
 
 
 
-SWIGINTERN int GPS_SpaceNode_Sl_double_Sg__read(GPS_SpaceNode< double > *self,char const *fname){
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
+SWIGINTERN int GPS_SpaceNode_Sl_double_Sg__read(GPS_SpaceNode< double > *self,std::istream &fin){
     typename RINEX_NAV_Reader<double>::space_node_list_t space_nodes = {self};
     space_nodes.qzss = self;
-    return RINEX_NAV_Reader<double>::read_all(fin, space_nodes);
+    ephemeris_generation_t::increment(self);
+    rinex_nav_read_t<double> task(fin, space_nodes);
+    solver_lock_t::run(self, task);
+    return task.res;
   }
 SWIGINTERN void GPS_Ionospheric_UTC_Parameters_Sl_double_Sg__set_alpha(GPS_Ionospheric_UTC_Parameters< double > *self,double const values[4]){
     for(int i(0); i < 4; ++i){
@@ -4142,9 +5430,47 @@ SWIGINTERN GPS_Ephemeris< double >::constellation_res_t GPS_Ephemeris_Sl_double_
 
     }
   
+SWIGINTERN VALUE GPS_User_PVT_Sl_double_Sg__to_packed(GPS_User_PVT< double > const *self,VALUE item){
+    // row-major native double String of a matrix without per-element conversion
+    struct packer_t {
+      static VALUE run(const Matrix_Frozen<double, Array2D_Dense<double> > &mat){
+        const unsigned int rows(mat.rows()), cols(mat.columns());
+        VALUE res(rb_str_new(NULL, sizeof(double) * rows * cols));
+        double *dst(reinterpret_cast<double *>(RSTRING_PTR(res)));
+        for(unsigned int i(0); i < rows; ++i){
+          for(unsigned int j(0); j < cols; ++j){*(dst++) = mat(i, j);}
+        }
+        return res;
+      }
+    };
+    ID id(SYMBOL_P(item) ? SYM2ID(item) : 0);
+    if(id == rb_intern("G")){return packer_t::run(self->G());}
+    if(id == rb_intern("W")){return packer_t::run(self->W());}
+    if(id == rb_intern("delta_r")){return packer_t::run(self->delta_r());}
+    if(id == rb_intern("G_enu")){return packer_t::run(self->G_enu());}
+    if(id == rb_intern("C")){return packer_t::run(self->C_cached());}
+    if(id == rb_intern("C_enu")){return packer_t::run(self->C_enu());}
+    if(id == rb_intern("S")){return packer_t::run(self->S_cached());}
+    if(id == rb_intern("S_enu")){return packer_t::run(self->S_enu());}
+    throw std::invalid_argument(
+        std::string("Unknown matrix: ").append(inspect_str(item)));
+  }
+SWIGINTERN VALUE GPS_User_PVT_Sl_double_Sg__other_state(GPS_User_PVT< double > const *self){
+    // rows of S * delta_r other than position and clock, in a single pass without temporaries
+    VALUE res(rb_ary_new());
+    if(!self->position_solved()){return res;}
+    const Matrix_Frozen<double, Array2D_Dense<double> > &s(self->S_cached()), &dr(self->delta_r());
+    for(unsigned int i(4), rows(s.rows()), cols(s.columns()); i < rows; ++i){
+      double v(0);
+      for(unsigned int j(0); j < cols; ++j){v += s(i, j) * dr(j, 0);}
+      rb_ary_push(res, DBL2NUM(v));
+    }
+    return res;
+  }
 SWIGINTERN void GPS_Measurement_Sl_double_Sg__each(GPS_Measurement< double > const *self,void const *check_block){
+    const GPS_Measurement<double>::items_t &items(self->items);
     for(typename GPS_Measurement<double>::items_t::const_iterator
-          it(self->items.begin()), it_end(self->items.end());
+          it(items.begin()), it_end(items.end());
         it != it_end; ++it){
       for(typename GPS_Measurement<double>::items_t::mapped_type::const_iterator 
             it2(it->second.begin()), it2_end(it->second.end());
@@ -4162,13 +5488,64 @@ SWIGINTERN void GPS_Measurement_Sl_double_Sg__each(GPS_Measurement< double > con
   }
 SWIGINTERN VALUE GPS_Measurement_Sl_double_Sg__to_hash(GPS_Measurement< double > const *self){
     VALUE res(rb_hash_new());
+    const GPS_Measurement<double>::items_t &items(self->items);
     for(typename GPS_Measurement<double>::items_t::const_iterator
-          it(self->items.begin()), it_end(self->items.end());
+          it(items.begin()), it_end(items.end());
         it != it_end; ++it){
       rb_hash_aset(res, SWIG_From_int  (it->first), swig::from(it->second));
     }
     return res;
   }
+SWIGINTERN int GPS_Measurement_Sl_double_Sg__add_packed(GPS_Measurement< double > *self,VALUE prns,VALUE keys,VALUE values){
+    // values: packed native double String, Array, or object responding to to_binary (ex. Numo::DFloat)
+    static const ID id_to_binary(rb_intern("to_binary"));
+    if((!RB_TYPE_P(values, T_STRING)) && (!RB_TYPE_P(values, T_ARRAY))
+        && rb_respond_to(values, id_to_binary)){
+      values = rb_funcall(values, id_to_binary, 0);
+    }
+    long n;
+    if(RB_TYPE_P(values, T_STRING)){
+      if((RSTRING_LEN(values) % sizeof(double)) != 0){
+        throw std::invalid_argument(
+            std::string("Length of packed values should be multiple of ")
+              .append(std::to_string(sizeof(double))));
+      }
+      n = (long)(RSTRING_LEN(values) / sizeof(double));
+    }else if(RB_TYPE_P(values, T_ARRAY)){
+      n = RARRAY_LEN(values);
+    }else{
+      throw std::invalid_argument(
+          std::string("Unexpected values: ").append(inspect_str(values)));
+    }
+    int prn_scalar, key_scalar;
+    bool prn_is_scalar(SWIG_IsOK(SWIG_AsVal_int (prns, &prn_scalar))),
+        key_is_scalar(SWIG_IsOK(SWIG_AsVal_int (keys, &key_scalar)));
+    if(((!prn_is_scalar) && ((!RB_TYPE_P(prns, T_ARRAY)) || (RARRAY_LEN(prns) != n)))
+        || ((!key_is_scalar) && ((!RB_TYPE_P(keys, T_ARRAY)) || (RARRAY_LEN(keys) != n)))){
+      throw std::invalid_argument(
+          std::string("PRN and key should be Integer or Array of Integer having ")
+            .append(std::to_string(n)).append(" elements"));
+    }
+    const char *packed(RB_TYPE_P(values, T_STRING) ? RSTRING_PTR(values) : NULL);
+    for(long i(0); i < n; ++i){
+      int prn(prn_scalar), key(key_scalar);
+      double v;
+      if(((!prn_is_scalar) && (!SWIG_IsOK(SWIG_AsVal_int (RARRAY_AREF(prns, i), &prn))))
+          || ((!key_is_scalar) && (!SWIG_IsOK(SWIG_AsVal_int (RARRAY_AREF(keys, i), &key))))){
+        throw std::invalid_argument(
+            std::string("Unexpected PRN or key @ [").append(std::to_string(i)).append("]"));
+      }
+      if(packed){
+        std::memcpy(&v, packed + (sizeof(double) * i), sizeof(double));
+      }else if(!SWIG_IsOK(swig::asval(RARRAY_AREF(values, i), &v))){
+        throw std::invalid_argument(
+            std::string("Unexpected value @ [").append(std::to_string(i)).append("]: ")
+              .append(inspect_str(RARRAY_AREF(values, i))));
+      }
+      self->add(prn, key, v);
+    }
+    return (int)n;
+  }
 SWIGINTERN double GPS_SolverOptions_Common_Sl_double_Sg__set_elevation_mask(GPS_SolverOptions_Common< double > *self,double const &v){
   return self->cast_general()->elevation_mask= v;
 }
@@ -4218,6 +5595,7 @@ SWIGINTERN bool const &GPS_SolverOptions_Common_Sl_double_Sg__get_use_external_s
       } res = {res_orig};
 
       do{
+        if(hooks_suspended){break;}
         static const VALUE key(ID2SYM(rb_intern("relative_property")));
         static const int prop_items(sizeof(res.values) / sizeof(res.values[0]));
         VALUE hook(rb_hash_lookup(hooks, key));
@@ -4280,11 +5658,19 @@ SWIGINTERN bool const &GPS_SolverOptions_Common_Sl_double_Sg__get_use_external_s
         GPS_Solver<double>::base_t::user_pvt_t &res) const {
 
       do{
+        if(hooks_suspended){break;}
         static const VALUE key(ID2SYM(rb_intern("update_position_solution")));
         VALUE hook(rb_hash_lookup(hooks, key));
         if(NIL_P(hook)){break;}
         base_t::geometric_matrices_t &geomat_(
             const_cast< base_t::geometric_matrices_t & >(geomat));
+        struct view_t { // res as GPS_User_PVT without copy, which is valid only during the hook
+          GPS_User_PVT<double> &pvt;
+          view_t(base_t::user_pvt_t &res)
+              : pvt(*reinterpret_cast<GPS_User_PVT<double> *>(
+                &static_cast<GPS_User_PVT<double>::base_t &>(res))) {}
+          ~view_t(){pvt.release_cache();} // cache of the temporary solution, if calculated
+        } view(res);
         VALUE values[] = {
             SWIG_NewPointerObj(&geomat_.G,
               SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0),
@@ -4292,12 +5678,18 @@ SWIGINTERN bool const &GPS_SolverOptions_Common_Sl_double_Sg__get_use_external_s
               SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0),
             SWIG_NewPointerObj(&geomat_.delta_r,
               SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0),
-            SWIG_NewPointerObj(&res,
+            SWIG_NewPointerObj(&view.pvt,
               SWIGTYPE_p_GPS_User_PVTT_double_t, 0)};
         proc_call_throw_if_error(hook, sizeof(values) / sizeof(values[0]), values);
       }while(false);
 
-      return super_t::update_position_solution(geomat, res);
+      bool is_final(super_t::update_position_solution(geomat, res));
+      int &left(tracking_state.iteration_left);
+      if((left >= 0) && ((left == 0) || (--left == 0))){
+        // iteration limit of a seeded epoch in tracking mode, shared with fault exclusion
+        is_final = true;
+      }
+      return is_final;
     }
     template <>
     GPS_Solver<double>::base_t::satellite_t GPS_Solver<double>::select_satellite(
@@ -4306,7 +5698,7 @@ SWIGINTERN bool const &GPS_SolverOptions_Common_Sl_double_Sg__get_use_external_s
         const GPS_Solver<double>::base_t::satellite_t &res_orig) const {
       GPS_Solver<double>::base_t::satellite_t res(res_orig);
 
-      if(!res.is_available()){
+      if((!hooks_suspended) && (!res.is_available())){
         static const VALUE key(ID2SYM(rb_intern("relative_property")));
         VALUE hook(rb_hash_lookup(hooks, key));
         if(!NIL_P(hook)){
@@ -4458,18 +5850,282 @@ SWIGINTERN VALUE GPS_Solver_Sl_double_Sg__get_correction(GPS_Solver< double > co
 SWIGINTERN VALUE GPS_Solver_Sl_double_Sg__set_correction(GPS_Solver< double > *self,VALUE hash){
     return self->update_correction(true, hash);
   }
-SWIGINTERN GPS_Solver< double >::super_t::options_t GPS_Solver_Sl_double_Sg__get_options(GPS_Solver< double > const *self){
+SWIGINTERN GPS_Solver< double >::options_t GPS_Solver_Sl_double_Sg__get_options(GPS_Solver< double > const *self){
     return self->available_options();
   }
-SWIGINTERN GPS_Solver< double >::super_t::options_t GPS_Solver_Sl_double_Sg__set_options(GPS_Solver< double > *self,VALUE obj){
-    GPS_Solver<double>::super_t::options_t opt(self->available_options());
+SWIGINTERN GPS_Solver< double >::options_t GPS_Solver_Sl_double_Sg__set_options(GPS_Solver< double > *self,VALUE obj){
+    GPS_Solver<double>::options_t opt(self->available_options());
 
     if(!RB_TYPE_P(obj, T_HASH)){SWIG_exception(SWIG_TypeError, "Hash is expected");}
     SWIG_AsVal_bool (
         rb_hash_lookup(obj, ID2SYM(rb_intern("skip_exclusion"))),
         &opt.skip_exclusion);
+    SWIG_AsVal_bool (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("tracking"))),
+        &opt.tracking);
+    SWIG_AsVal_int (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("tracking_iteration_max"))),
+        &opt.tracking_iteration_max);
+    SWIG_AsVal_bool (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("ekf"))),
+        &opt.ekf);
+    SWIG_AsVal_double (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("ekf_q_acceleration"))),
+        &opt.ekf_q_acceleration);
+    SWIG_AsVal_double (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("ekf_q_clock"))),
+        &opt.ekf_q_clock);
+    SWIG_AsVal_double (
+        rb_hash_lookup(obj, ID2SYM(rb_intern("ekf_q_clock_drift"))),
+        &opt.ekf_q_clock_drift);
+
+    struct update_t : public solver_lock_t::task_t { // with GVL
+      GPS_Solver<double> &solver;
+      const GPS_Solver<double>::options_t &opt;
+      GPS_Solver<double>::options_t res;
+      update_t(GPS_Solver<double> &solver_, const GPS_Solver<double>::options_t &opt_)
+          : solver_lock_t::task_t(), solver(solver_), opt(opt_), res(opt_) {}
+      void operator()(){res = solver.update_options(opt);}
+    } task(*self, opt);
+    self->lock.run(task); // wait for a task running in another thread
+    return task.res;
+  }
+SWIGINTERN VALUE GPS_Solver_Sl_double_Sg__solve_batch(GPS_Solver< double > const *self,VALUE measurements,VALUE times){
+    if((!RB_TYPE_P(measurements, T_ARRAY)) || (!RB_TYPE_P(times, T_ARRAY))
+        || (RARRAY_LEN(measurements) != RARRAY_LEN(times))){
+      throw std::invalid_argument(
+          std::string("Arrays of measurement and time having the same length are expected, however ")
+            .append(inspect_str(measurements)).append(", ").append(inspect_str(times)));
+    }
+    const long epochs(RARRAY_LEN(times));
+
+    // 1st step: conversion of inputs (with GVL)
+    // Inputs are copied, because Ruby objects may be modified by other threads without GVL.
+    std::vector<GPS_Measurement<double> > meas_list(epochs);
+    std::vector<GPS_Time<double> > time_list(epochs);
+    for(long i(0); i < epochs; ++i){
+      GPS_Measurement<double> *measurement;
+      VALUE v_meas(RARRAY_AREF(measurements, i)), v_time(RARRAY_AREF(times, i));
+      if(SWIG_IsOK(SWIG_ConvertPtr(v_meas, (void **)&measurement, SWIGTYPE_p_GPS_MeasurementT_double_t, 0))){
+        meas_list[i] = *measurement;
+      }else if(!SWIG_IsOK(swig::asval(v_meas, &meas_list[i]))){
+        throw std::invalid_argument(
+            std::string("Unexpected measurement @ [").append(std::to_string(i)).append("]: ")
+              .append(inspect_str(v_meas)));
+      }
+      void *time_ptr(NULL);
+      if((!SWIG_IsOK(SWIG_ConvertPtr(v_time, &time_ptr, SWIGTYPE_p_GPS_TimeT_double_t, 0)))
+          || (!time_ptr)){
+        throw std::invalid_argument(
+            std::string("Unexpected time @ [").append(std::to_string(i)).append("]: ")
+              .append(inspect_str(v_time)));
+      }
+      time_list[i] = *reinterpret_cast<const GPS_Time<double> *>(time_ptr);
+    }
+
+    // 2nd step: solve (without GVL if possible)
+    struct batch_task_t : public GPS_Solver<double>::task_t {
+      const GPS_Solver<double> &solver;
+      const std::vector<GPS_Measurement<double> > &meas_list;
+      const std::vector<GPS_Time<double> > &time_list;
+      std::vector<int> error_code;
+      std::vector<double> xyz, llh, receiver_error, velocity, receiver_error_rate, dop, sigma;
+      std::vector<std::vector<int> > used_satellite_list;
+      batch_task_t(
+          const GPS_Solver<double> &solver_,
+          const std::vector<GPS_Measurement<double> > &meas_list_,
+          const std::vector<GPS_Time<double> > &time_list_)
+          : GPS_Solver<double>::task_t(),
+          solver(solver_), meas_list(meas_list_), time_list(time_list_) {
+        std::size_t epochs(time_list.size());
+        error_code.reserve(epochs);
+        xyz.reserve(epochs * 3); llh.reserve(epochs * 3); receiver_error.reserve(epochs);
+        velocity.reserve(epochs * 3); receiver_error_rate.reserve(epochs);
+        dop.reserve(epochs * 5); sigma.reserve(epochs * 4);
+        used_satellite_list.reserve(epochs);
+      }
+      void operator()(const volatile bool &canceled){
+        static const double nan(std::numeric_limits<double>::quiet_NaN());
+        GPS_Solver<double>::batch_t batch(solver);
+        for(std::size_t i(error_code.size()); i < time_list.size(); ++i){ // resume if canceled
+          if(canceled){return;}
+          GPS_User_PVT<double> pvt(batch.solve(meas_list[i], time_list[i]));
+          error_code.push_back(pvt.error_code());
+          if(pvt.position_solved()){
+            System_XYZ<double, WGS84> xyz_(pvt.xyz());
+            System_LLH<double, WGS84> llh_(pvt.llh());
+            double values[] = {
+              xyz_.x(), xyz_.y(), xyz_.z(),
+              llh_.latitude(), llh_.longitude(), llh_.height(),
+              pvt.receiver_error(),
+              pvt.gdop(), pvt.pdop(), pvt.hdop(), pvt.vdop(), pvt.tdop(),
+              pvt.hsigma(), pvt.vsigma(), pvt.tsigma()};
+            xyz.insert(xyz.end(), &values[0], &values[3]);
+            llh.insert(llh.end(), &values[3], &values[6]);
+            receiver_error.push_back(values[6]);
+            dop.insert(dop.end(), &values[7], &values[12]);
+            sigma.insert(sigma.end(), &values[12], &values[15]);
+            used_satellite_list.push_back(pvt.used_satellite_list());
+          }else{
+            xyz.insert(xyz.end(), 3, nan);
+            llh.insert(llh.end(), 3, nan);
+            receiver_error.push_back(nan);
+            dop.insert(dop.end(), 5, nan);
+            sigma.insert(sigma.end(), 3, nan);
+            used_satellite_list.push_back(std::vector<int>());
+          }
+          if(pvt.velocity_solved()){
+            System_ENU<double, WGS84> vel(pvt.velocity());
+            velocity.push_back(vel.east());
+            velocity.push_back(vel.north());
+            velocity.push_back(vel.up());
+            receiver_error_rate.push_back(pvt.receiver_error_rate());
+            sigma.push_back(pvt.vel_sigma());
+          }else{
+            velocity.insert(velocity.end(), 3, nan);
+            receiver_error_rate.push_back(nan);
+            sigma.push_back(nan);
+          }
+        }
+        task_t::done = true;
+      }
+      static VALUE packed(const std::vector<double> &v){
+        return rb_str_new(
+            reinterpret_cast<const char *>(v.empty() ? NULL : &v[0]),
+            (long)(sizeof(double) * v.size()));
+      }
+    } task(*self, meas_list, time_list);
+    self->run(task);
+
+    // 3rd step: conversion of outputs (with GVL)
+    VALUE res(rb_hash_new());
+    rb_hash_aset(res, ID2SYM(rb_intern("epochs")), LONG2NUM(epochs));
+    {
+      VALUE ary(rb_ary_new_capa(epochs));
+      for(std::vector<int>::const_iterator it(task.error_code.begin()), it_end(task.error_code.end());
+          it != it_end; ++it){
+        rb_ary_push(ary, SWIG_From_int  (*it));
+      }
+      rb_hash_aset(res, ID2SYM(rb_intern("error_code")), ary);
+    }
+    rb_hash_aset(res, ID2SYM(rb_intern("xyz")), batch_task_t::packed(task.xyz));
+    rb_hash_aset(res, ID2SYM(rb_intern("llh")), batch_task_t::packed(task.llh));
+    rb_hash_aset(res, ID2SYM(rb_intern("receiver_error")), batch_task_t::packed(task.receiver_error));
+    rb_hash_aset(res, ID2SYM(rb_intern("velocity")), batch_task_t::packed(task.velocity));
+    rb_hash_aset(res, ID2SYM(rb_intern("receiver_error_rate")), batch_task_t::packed(task.receiver_error_rate));
+    rb_hash_aset(res, ID2SYM(rb_intern("dop")), batch_task_t::packed(task.dop));
+    rb_hash_aset(res, ID2SYM(rb_intern("sigma")), batch_task_t::packed(task.sigma));
+    {
+      VALUE ary(rb_ary_new_capa(epochs));
+      for(std::vector<std::vector<int> >::const_iterator
+            it(task.used_satellite_list.begin()), it_end(task.used_satellite_list.end());
+          it != it_end; ++it){
+        VALUE prns(rb_ary_new_capa((long)it->size()));
+        for(std::vector<int>::const_iterator it2(it->begin()), it2_end(it->end());
+            it2 != it2_end; ++it2){
+          rb_ary_push(prns, SWIG_From_int  (*it2));
+        }
+        rb_ary_push(ary, prns);
+      }
+      rb_hash_aset(res, ID2SYM(rb_intern("used_satellite_list")), ary);
+    }
+    return res;
+  }
+SWIGINTERN VALUE GPS_Solver_Sl_double_Sg__dop_map(VALUE receivers,VALUE satellites,VALUE options=Qnil){
+    // 1st step: conversion of inputs (with GVL)
+    struct positions_t {
+      // packed native double String, or Array of [x, y, z] in ECEF
+      static std::vector<double> get(const VALUE &v, const char *name){
+        std::vector<double> res;
+        if(RB_TYPE_P(v, T_STRING) && ((RSTRING_LEN(v) % (sizeof(double) * 3)) == 0)){
+          res.resize(RSTRING_LEN(v) / sizeof(double));
+          if(!res.empty()){std::memcpy(&res[0], RSTRING_PTR(v), RSTRING_LEN(v));}
+          return res;
+        }
+        if(RB_TYPE_P(v, T_ARRAY)){
+          res.reserve(RARRAY_LEN(v) * 3);
+          bool converted(true);
+          for(long i(0), i_max(RARRAY_LEN(v)); converted && (i < i_max); ++i){
+            VALUE v_pos(RARRAY_AREF(v, i));
+            converted = (RB_TYPE_P(v_pos, T_ARRAY) && (RARRAY_LEN(v_pos) == 3));
+            for(long j(0); converted && (j < 3); ++j){
+              double buf;
+              if((converted = SWIG_IsOK(SWIG_AsVal_double(RARRAY_AREF(v_pos, j), &buf)))){
+                res.push_back(buf);
+              }
+            }
+          }
+          if(converted){return res;}
+        }
+        throw std::invalid_argument(
+            std::string("Unexpected ").append(name).append(" (packed String or Array of [x, y, z] expected): ")
+              .append(inspect_str(v)));
+      }
+    };
+    std::vector<double> rcv(positions_t::get(receivers, "receivers")), sat(positions_t::get(satellites, "satellites"));
+    enum {PRECISION_FLOAT, PRECISION_DOUBLE, PRECISION_LONG_DOUBLE} precision(PRECISION_DOUBLE);
+    double elevation_mask(0);
+    if(!NIL_P(options)){
+      if(!RB_TYPE_P(options, T_HASH)){
+        throw std::invalid_argument(std::string("Hash is expected: ").append(inspect_str(options)));
+      }
+      VALUE v;
+      if(!NIL_P(v = rb_hash_lookup(options, ID2SYM(rb_intern("elevation_mask"))))
+          && !SWIG_IsOK(SWIG_AsVal_double(v, &elevation_mask))){
+        throw std::invalid_argument(std::string("Unexpected elevation_mask: ").append(inspect_str(v)));
+      }
+      if(!NIL_P(v = rb_hash_lookup(options, ID2SYM(rb_intern("precision"))))){
+        if(v == ID2SYM(rb_intern("float"))){
+          precision = PRECISION_FLOAT;
+        }else if(v == ID2SYM(rb_intern("long_double"))){
+          precision = PRECISION_LONG_DOUBLE;
+        }else if(v != ID2SYM(rb_intern("double"))){
+          throw std::invalid_argument(std::string("Unknown precision: ").append(inspect_str(v)));
+        }
+      }
+    }
+
+    // 2nd step: calculate (without GVL); no solver state is used, therefore, no lock
+    struct dop_map_task_t : public GPS_Solver<double>::task_t {
+      const std::vector<double> &rcv, &sat;
+      const double &elevation_mask;
+      const int precision;
+      std::vector<double> dop;
+      dop_map_task_t(
+          const std::vector<double> &rcv_, const std::vector<double> &sat_,
+          const double &elevation_mask_, const int &precision_)
+          : GPS_Solver<double>::task_t(),
+          rcv(rcv_), sat(sat_), elevation_mask(elevation_mask_), precision(precision_),
+          dop(rcv_.size() / 3 * 5), next(0) {}
+      std::size_t next; // receiver index to resume if canceled
+      void operator()(const volatile bool &canceled){
+        for(std::size_t &i(next), i_max(rcv.size() / 3); i < i_max; ++i){
+          if(canceled){return;}
+          double (&res)[5](*reinterpret_cast<double (*)[5]>(&dop[i * 5]));
+          switch(precision){
+            case PRECISION_FLOAT:
+              GPS_Solver<double>::dop_geometry<float>(
+                  &rcv[i * 3], sat.empty() ? NULL : &sat[0], sat.size() / 3, elevation_mask, res);
+              break;
+            case PRECISION_LONG_DOUBLE:
+              GPS_Solver<double>::dop_geometry<long double>(
+                  &rcv[i * 3], sat.empty() ? NULL : &sat[0], sat.size() / 3, elevation_mask, res);
+              break;
+            default:
+              GPS_Solver<double>::dop_geometry<double>(
+                  &rcv[i * 3], sat.empty() ? NULL : &sat[0], sat.size() / 3, elevation_mask, res);
+              break;
+          }
+        }
+        task_t::done = true;
+      }
+    } task(rcv, sat, elevation_mask, precision);
+    GPS_Solver<double>::run_without_gvl(task);
 
-    return self->update_options(opt);
+    // 3rd step: conversion of outputs (with GVL)
+    return rb_str_new(
+        reinterpret_cast<const char *>(task.dop.empty() ? NULL : &task.dop[0]),
+        (long)(sizeof(double) * task.dop.size()));
   }
 SWIGINTERN unsigned int SBAS_Ephemeris_Sl_double_Sg__set_svid(SBAS_Ephemeris< double > *self,unsigned int const &v){
   return self->svid= v;
@@ -4575,19 +6231,25 @@ SWIGINTERN GPS_Ephemeris< double >::constellation_res_t SBAS_Ephemeris_Sl_double
     return res;
   }
 SWIGINTERN void SBAS_SpaceNode_Sl_double_Sg__register_ephemeris__SWIG_0(SBAS_SpaceNode< double > *self,int const &prn,SBAS_Ephemeris< double > const &eph,int const &priority_delta=1){
+    solver_lock_t::wait(self);
     self->satellite(prn).register_ephemeris(eph, priority_delta);
+    ephemeris_generation_t::increment(self);
   }
 SWIGINTERN SBAS_Ephemeris< double > SBAS_SpaceNode_Sl_double_Sg__ephemeris(SBAS_SpaceNode< double > const *self,int const &prn){
     return SBAS_Ephemeris<double>(
         const_cast< SBAS_SpaceNode<double> * >(self)->satellite(prn).ephemeris());
   }
-SWIGINTERN int SBAS_SpaceNode_Sl_double_Sg__read(SBAS_SpaceNode< double > *self,char const *fname){
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
+SWIGINTERN int SBAS_SpaceNode_Sl_double_Sg__read(SBAS_SpaceNode< double > *self,std::istream &fin){
     RINEX_NAV_Reader<double>::space_node_list_t space_nodes = {NULL};
     space_nodes.sbas = self;
-    return RINEX_NAV_Reader<double>::read_all(fin, space_nodes);
+    ephemeris_generation_t::increment(self);
+    rinex_nav_read_t<double> task(fin, space_nodes);
+    solver_lock_t::run(self, task);
+    return task.res;
   }
 SWIGINTERN int SBAS_SpaceNode_Sl_double_Sg__decode_message__SWIG_2(SBAS_SpaceNode< double > *self,unsigned int const buf[8],int const &prn,GPS_Time< double > const &t_reception,bool const &LNAV_VNAV_LP_LPV_approach=false){
+    solver_lock_t::wait(self);
+    ephemeris_generation_t::increment(self);
     return static_cast<int>(
         self->decode_message(buf, prn, t_reception, LNAV_VNAV_LP_LPV_approach));
   }
@@ -4605,17 +6267,21 @@ SWIG_From_std_string  (const std::string& s)
 }
 
 SWIGINTERN void GLONASS_SpaceNode_Sl_double_Sg__register_ephemeris__SWIG_0(GLONASS_SpaceNode< double > *self,int const &prn,GLONASS_Ephemeris< double > const &eph,int const &priority_delta=1){
+    solver_lock_t::wait(self);
     self->satellite(prn).register_ephemeris(eph, priority_delta);
+    ephemeris_generation_t::increment(self);
   }
 SWIGINTERN GLONASS_Ephemeris< double > GLONASS_SpaceNode_Sl_double_Sg__ephemeris(GLONASS_SpaceNode< double > const *self,int const &prn){
     return GLONASS_Ephemeris<double>(
         const_cast< GLONASS_SpaceNode<double> * >(self)->satellite(prn).ephemeris());
   }
-SWIGINTERN int GLONASS_SpaceNode_Sl_double_Sg__read(GLONASS_SpaceNode< double > *self,char const *fname){
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
+SWIGINTERN int GLONASS_SpaceNode_Sl_double_Sg__read(GLONASS_SpaceNode< double > *self,std::istream &fin){
     typename RINEX_NAV_Reader<double>::space_node_list_t list = {NULL};
     list.glonass = self;
-    return RINEX_NAV_Reader<double>::read_all(fin, list);
+    ephemeris_generation_t::increment(self);
+    rinex_nav_read_t<double> task(fin, list);
+    solver_lock_t::run(self, task);
+    return task.res;
   }
 
 SWIGINTERNINLINE VALUE
@@ -4897,15 +6563,15 @@ SWIGINTERN void GLONASS_Ephemeris_Sl_double_Sg__dump(GLONASS_Ephemeris< double >
     }
     raw.GLONASS_Ephemeris<double>::TimeProperties::raw_t::dump<0, 0>(buf_str5);
   }
-SWIGINTERN GPS_Ephemeris< double >::constellation_res_t GLONASS_Ephemeris_Sl_double_Sg__constellation__SWIG_0(GLONASS_Ephemeris< double > const *self,GPS_Time< double > const &t_tx,double const &dt_transit=0){
-    typename GPS_SpaceNode<double>::SatelliteProperties::constellation_t pv(
-        self->constellation(t_tx, dt_transit));
+SWIGINTERN GPS_Ephemeris< double >::constellation_res_t GLONASS_Ephemeris_Sl_double_Sg__constellation__SWIG_0(GLONASS_Ephemeris< double > const *self,GPS_Time< double > const &t_tx,double const &dt_transit=0,bool const &use_cache=true){
+    typename GPS_SpaceNode<double>::SatelliteProperties::constellation_t pv(use_cache
+        ? self->constellation_cached(t_tx, dt_transit)
+        : self->constellation(t_tx, dt_transit));
     typename GPS_Ephemeris<double>::constellation_res_t res = {
         pv.position, pv.velocity, self->clock_error(t_tx), self->clock_error_dot()};
     return res;
   }
-SWIGINTERN void RINEX_Observation_Sl_double_Sg__read(char const *fname,void const *check_block){
-    std::fstream fin(fname, std::ios::in | std::ios::binary);
+SWIGINTERN void RINEX_Observation_Sl_double_Sg__read(std::istream &fin,void const *check_block){
     struct reader_t : public RINEX_OBS_Reader<double> {
       typedef RINEX_OBS_Reader<double> super_t;
       VALUE header;
@@ -4992,6 +6658,135 @@ SWIGINTERN void RINEX_Observation_Sl_double_Sg__read(char const *fname,void cons
 
     }
   }
+SWIGINTERN int RINEX_Observation_Sl_double_Sg__read_measurement(std::istream &fin,VALUE supplier){
+    struct reader_t : public RINEX_OBS_Reader<double> {
+      typedef RINEX_OBS_Reader<double> super_t;
+      typename RINEX_Observation<double>::measurement_mapper_t mapper;
+      reader_t(std::istream &in)
+          : RINEX_OBS_Reader<double>(in), mapper(super_t::header(), super_t::obs_types) {}
+    } reader(fin);
+    std::vector<int> glonass_freq_missing;
+    int epochs(0);
+    while(reader.has_next()){
+      typedef typename reader_t::observation_t obs_t;
+      obs_t obs(reader.next());
+
+      VALUE values[4];
+      GPS_Measurement<double> *meas;
+      if(NIL_P(supplier)){
+        values[0] = SWIG_NewPointerObj(
+            meas = new GPS_Measurement<double>(),
+            SWIGTYPE_p_GPS_MeasurementT_double_t, SWIG_POINTER_OWN);
+      }else{ // reuse measurement given by supplier
+        values[0] = proc_call_throw_if_error(supplier, 0, NULL);
+        if(!SWIG_IsOK(SWIG_ConvertPtr(values[0], (void **)&meas, SWIGTYPE_p_GPS_MeasurementT_double_t, 0))){
+          throw std::invalid_argument(
+              std::string("Supplier should return GPS::Measurement: ").append(inspect_str(values[0])));
+        }
+        meas->clear();
+      }
+      reader.mapper.convert<reader_t>(obs, *meas, glonass_freq_missing);
+      values[1] = SWIG_NewPointerObj(
+          new GPS_Time<double>(obs.t_epoch),
+          SWIGTYPE_p_GPS_TimeT_double_t, SWIG_POINTER_OWN);
+      values[2] = swig::from(obs.receiver_clock_error);
+      values[3] = Qnil;
+      if(!glonass_freq_missing.empty()){
+        values[3] = rb_ary_new_capa(glonass_freq_missing.size());
+        for(std::vector<int>::const_iterator
+              it(glonass_freq_missing.begin()), it_end(glonass_freq_missing.end());
+            it != it_end; ++it){
+          rb_ary_push(values[3], SWIG_From_int  (*it));
+        }
+      }
+      ++epochs;
+      yield_throw_if_error(sizeof(values) / sizeof(values[0]), values);
+    }
+    return epochs;
+  }
+SWIGINTERN int RINEX_Observation_Sl_double_Sg__read_packed(std::istream &fin,int const &epochs_per_block=1){
+    if(epochs_per_block <= 0){
+      throw std::invalid_argument("Epochs per block should be positive");
+    }
+    struct reader_t : public RINEX_OBS_Reader<double> {
+      typedef RINEX_OBS_Reader<double> super_t;
+      typename RINEX_Observation<double>::measurement_mapper_t mapper;
+      reader_t(std::istream &in)
+          : RINEX_OBS_Reader<double>(in), mapper(super_t::header(), super_t::obs_types) {}
+    } reader(fin);
+    struct block_t {
+      std::vector<int> offset, prn, key, week;
+      std::vector<double> value, seconds, clock_error;
+      std::vector<int> glonass_freq_missing; // pairs of (epoch index in block, PRN)
+      void add(const int &prn_, const int &key_, const double &value_){
+        prn.push_back(prn_);
+        key.push_back(key_);
+        value.push_back(value_);
+      }
+      void clear(){
+        offset.clear(); prn.clear(); key.clear(); value.clear();
+        week.clear(); seconds.clear(); clock_error.clear();
+        glonass_freq_missing.clear();
+      }
+      template <class T>
+      static VALUE pack(const std::vector<T> &v){
+        return rb_str_new(v.empty() ? NULL : (const char *)&v[0], sizeof(T) * v.size());
+      }
+      VALUE flush(){
+        static const VALUE
+            sym_epochs(ID2SYM(rb_intern("epochs"))),
+            sym_week(ID2SYM(rb_intern("week"))),
+            sym_seconds(ID2SYM(rb_intern("seconds"))),
+            sym_clke(ID2SYM(rb_intern("rcv_clock_error"))),
+            sym_glonass_missing(ID2SYM(rb_intern("glonass_freq_missing"))),
+            sym_offset(ID2SYM(rb_intern("offset"))),
+            sym_prn(ID2SYM(rb_intern("prn"))),
+            sym_key(ID2SYM(rb_intern("key"))),
+            sym_value(ID2SYM(rb_intern("value")));
+        VALUE res(rb_hash_new());
+        rb_hash_aset(res, sym_epochs, SWIG_From_int  ((int)clock_error.size()));
+        rb_hash_aset(res, sym_week, pack(week));
+        rb_hash_aset(res, sym_seconds, pack(seconds));
+        rb_hash_aset(res, sym_clke, pack(clock_error));
+        rb_hash_aset(res, sym_glonass_missing, pack(glonass_freq_missing));
+        offset.push_back((int)prn.size());
+        rb_hash_aset(res, sym_offset, pack(offset));
+        rb_hash_aset(res, sym_prn, pack(prn));
+        rb_hash_aset(res, sym_key, pack(key));
+        rb_hash_aset(res, sym_value, pack(value));
+        clear();
+        return res;
+      }
+    } block;
+    block.clear();
+    std::vector<int> glonass_freq_missing;
+    int epochs(0);
+    while(reader.has_next()){
+      typedef typename reader_t::observation_t obs_t;
+      obs_t obs(reader.next());
+
+      block.week.push_back(obs.t_epoch.week);
+      block.seconds.push_back(obs.t_epoch.seconds);
+      block.offset.push_back((int)block.prn.size());
+      reader.mapper.convert<reader_t>(obs, block, glonass_freq_missing);
+      for(std::vector<int>::const_iterator
+            it(glonass_freq_missing.begin()), it_end(glonass_freq_missing.end());
+          it != it_end; ++it){ // to be resolved with ephemeris as read_measurement
+        block.glonass_freq_missing.push_back((int)block.clock_error.size());
+        block.glonass_freq_missing.push_back(*it);
+      }
+      block.clock_error.push_back(obs.receiver_clock_error);
+      ++epochs;
+      if((int)block.clock_error.size() < epochs_per_block){continue;}
+      VALUE res(block.flush());
+      yield_throw_if_error(1, &res);
+    }
+    if(!block.clock_error.empty()){
+      VALUE res(block.flush());
+      yield_throw_if_error(1, &res);
+    }
+    return epochs;
+  }
 static swig_class SwigClassGC_VALUE;
 
 /*
@@ -8031,6 +9826,7 @@ _wrap_SpaceNode_update_iono_utc__SWIG_0(int argc, VALUE *argv, VALUE self) {
   } 
   temp4 = static_cast< bool >(val4);
   arg4 = &temp4;
+  solver_lock_t::wait(arg1);
   result = (GPS_SpaceNode< double >::Ionospheric_UTC_Parameters *) &(arg1)->update_iono_utc((GPS_SpaceNode< double >::Ionospheric_UTC_Parameters const &)*arg2,(bool const &)*arg3,(bool const &)*arg4);
   {
     vresult = SWIG_NewPointerObj(
@@ -8082,6 +9878,7 @@ _wrap_SpaceNode_update_iono_utc__SWIG_1(int argc, VALUE *argv, VALUE self) {
   } 
   temp3 = static_cast< bool >(val3);
   arg3 = &temp3;
+  solver_lock_t::wait(arg1);
   result = (GPS_SpaceNode< double >::Ionospheric_UTC_Parameters *) &(arg1)->update_iono_utc((GPS_SpaceNode< double >::Ionospheric_UTC_Parameters const &)*arg2,(bool const &)*arg3);
   {
     vresult = SWIG_NewPointerObj(
@@ -8123,6 +9920,7 @@ _wrap_SpaceNode_update_iono_utc__SWIG_2(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_SpaceNode< double >::Ionospheric_UTC_Parameters const &","update_iono_utc", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< GPS_SpaceNode< double >::Ionospheric_UTC_Parameters * >(argp2);
+  solver_lock_t::wait(arg1);
   result = (GPS_SpaceNode< double >::Ionospheric_UTC_Parameters *) &(arg1)->update_iono_utc((GPS_SpaceNode< double >::Ionospheric_UTC_Parameters const &)*arg2);
   {
     vresult = SWIG_NewPointerObj(
@@ -8296,7 +10094,9 @@ _wrap_SpaceNode_update_all_ephemeris(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_SpaceNode< double >::gps_time_t const &","update_all_ephemeris", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< GPS_SpaceNode< double >::gps_time_t * >(argp2);
+  solver_lock_t::wait(arg1);
   (arg1)->update_all_ephemeris((GPS_SpaceNode< double >::gps_time_t const &)*arg2);
+  ephemeris_generation_t::increment(arg1);
   return Qnil;
 fail:
   return Qnil;
@@ -8348,7 +10148,9 @@ _wrap_SpaceNode_merge__SWIG_0(int argc, VALUE *argv, VALUE self) {
   } 
   temp3 = static_cast< bool >(val3);
   arg3 = &temp3;
+  solver_lock_t::wait(arg1);
   (arg1)->merge((GPS_SpaceNode< double >::self_t const &)*arg2,(bool const &)*arg3);
+  ephemeris_generation_t::increment(arg1);
   return Qnil;
 fail:
   return Qnil;
@@ -8380,7 +10182,9 @@ _wrap_SpaceNode_merge__SWIG_1(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_SpaceNode< double >::self_t const &","merge", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< GPS_SpaceNode< double >::self_t * >(argp2);
+  solver_lock_t::wait(arg1);
   (arg1)->merge((GPS_SpaceNode< double >::self_t const &)*arg2);
+  ephemeris_generation_t::increment(arg1);
   return Qnil;
 fail:
   return Qnil;
@@ -9445,7 +11249,7 @@ fail:
   Document-method: GPS_PVT::GPS::SpaceNode.read
 
   call-seq:
-    read(char const * fname) -> int
+    read(std::istream & in) -> int
 
 An instance method.
 
@@ -9453,12 +11257,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_SpaceNode_read(int argc, VALUE *argv, VALUE self) {
   GPS_SpaceNode< double > *arg1 = (GPS_SpaceNode< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -9470,17 +11272,29 @@ _wrap_SpaceNode_read(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_SpaceNode< double > *","read", 1, self )); 
   }
   arg1 = reinterpret_cast< GPS_SpaceNode< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","read", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read", 2, argv[0] ));
+  }
+  arg2 = &(in2->in);
+  try {
+    result = (int)GPS_SpaceNode_Sl_double_Sg__read(arg1,*arg2);
+  } catch(native_exception &_e) {
+    input_stream_t::release(in2);
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::exception &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)GPS_SpaceNode_Sl_double_Sg__read(arg1,(char const *)arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -14406,6 +16220,8 @@ _wrap_PVT_G(int argc, VALUE *argv, VALUE self) {
   arg1 = reinterpret_cast< GPS_User_PVT< double > * >(argp1);
   result = (Matrix_Frozen< double,Array2D_Dense< double > > *) &((GPS_User_PVT< double > const *)arg1)->G();
   vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
+  rb_iv_set(vresult, "@__pvt__", self); // view refers to memory owned by PVT
+  rb_obj_freeze(vresult); // reference to PVT must not be replaced
   return vresult;
 fail:
   return Qnil;
@@ -14439,6 +16255,8 @@ _wrap_PVT_W(int argc, VALUE *argv, VALUE self) {
   arg1 = reinterpret_cast< GPS_User_PVT< double > * >(argp1);
   result = (Matrix_Frozen< double,Array2D_Dense< double > > *) &((GPS_User_PVT< double > const *)arg1)->W();
   vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
+  rb_iv_set(vresult, "@__pvt__", self); // view refers to memory owned by PVT
+  rb_obj_freeze(vresult); // reference to PVT must not be replaced
   return vresult;
 fail:
   return Qnil;
@@ -14472,6 +16290,8 @@ _wrap_PVT_delta_r(int argc, VALUE *argv, VALUE self) {
   arg1 = reinterpret_cast< GPS_User_PVT< double > * >(argp1);
   result = (Matrix_Frozen< double,Array2D_Dense< double > > *) &((GPS_User_PVT< double > const *)arg1)->delta_r();
   vresult = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
+  rb_iv_set(vresult, "@__pvt__", self); // view refers to memory owned by PVT
+  rb_obj_freeze(vresult); // reference to PVT must not be replaced
   return vresult;
 fail:
   return Qnil;
@@ -15140,6 +16960,82 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::GPS::PVT.to_packed
+
+  call-seq:
+    to_packed(VALUE item) -> VALUE
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_PVT_to_packed(int argc, VALUE *argv, VALUE self) {
+  GPS_User_PVT< double > *arg1 = (GPS_User_PVT< double > *) 0 ;
+  VALUE arg2 = (VALUE) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_User_PVTT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_User_PVT< double > const *","to_packed", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_User_PVT< double > * >(argp1);
+  arg2 = argv[0];
+  try {
+    result = (VALUE)GPS_User_PVT_Sl_double_Sg__to_packed((GPS_User_PVT< double > const *)arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = result;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+
+/*
+  Document-method: GPS_PVT::GPS::PVT.other_state
+
+  call-seq:
+    other_state -> VALUE
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_PVT_other_state(int argc, VALUE *argv, VALUE self) {
+  GPS_User_PVT< double > *arg1 = (GPS_User_PVT< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_User_PVTT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_User_PVT< double > const *","other_state", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_User_PVT< double > * >(argp1);
+  result = (VALUE)GPS_User_PVT_Sl_double_Sg__other_state((GPS_User_PVT< double > const *)arg1);
+  vresult = result;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN void
 free_GPS_User_PVT_Sl_double_Sg_(void *self) {
     GPS_User_PVT< double > *arg1 = (GPS_User_PVT< double > *)self;
@@ -15530,6 +17426,35 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::GPS::Measurement.clear
+
+  call-seq:
+    clear
+
+Clear Measurement contents.
+*/
+SWIGINTERN VALUE
+_wrap_Measurement_clear(int argc, VALUE *argv, VALUE self) {
+  GPS_Measurement< double > *arg1 = (GPS_Measurement< double > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_MeasurementT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Measurement< double > *","clear", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_Measurement< double > * >(argp1);
+  (arg1)->clear();
+  return Qnil;
+fail:
+  return Qnil;
+}
+
+
 /*
   Document-method: GPS_PVT::GPS::Measurement.each
 
@@ -15571,6 +17496,49 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::GPS::Measurement.add_packed
+
+  call-seq:
+    add_packed(VALUE prns, VALUE keys, VALUE values) -> int
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Measurement_add_packed(int argc, VALUE *argv, VALUE self) {
+  GPS_Measurement< double > *arg1 = (GPS_Measurement< double > *) 0 ;
+  VALUE arg2 = (VALUE) 0 ;
+  VALUE arg3 = (VALUE) 0 ;
+  VALUE arg4 = (VALUE) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_MeasurementT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Measurement< double > *","add_packed", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_Measurement< double > * >(argp1);
+  arg2 = argv[0];
+  arg3 = argv[1];
+  arg4 = argv[2];
+  try {
+    result = (int)GPS_Measurement_Sl_double_Sg__add_packed(arg1,arg2,arg3,arg4);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 /*
   Document-method: GPS_PVT::GPS::Measurement.to_hash
 
@@ -16478,6 +18446,60 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::GPS::Solver.read_rinex_nav
+
+  call-seq:
+    read_rinex_nav(std::istream & in) -> int
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Solver_read_rinex_nav(int argc, VALUE *argv, VALUE self) {
+  GPS_Solver< double > *arg1 = (GPS_Solver< double > *) 0 ;
+  std::istream *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  input_stream_t *in2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_SolverT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Solver< double > *","read_rinex_nav", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_Solver< double > * >(argp1);
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read_rinex_nav", 2, argv[0] ));
+  }
+  arg2 = &(in2->in);
+  try {
+    result = (int)(arg1)->read_rinex_nav(*arg2);
+  } catch(native_exception &_e) {
+    input_stream_t::release(in2);
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::exception &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  input_stream_t::release(in2);
+  return vresult;
+fail:
+  input_stream_t::release(in2);
+  return Qnil;
+}
+
+
 /*
   Document-method: GPS_PVT::GPS::Solver.solve
 
@@ -16500,37 +18522,127 @@ _wrap_Solver_solve(int argc, VALUE *argv, VALUE self) {
   GPS_User_PVT< double > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_SolverT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Solver< double > const *","solve", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_Solver< double > * >(argp1);
+  {
+    if((!SWIG_IsOK(SWIG_ConvertPtr(argv[0], (void **)&arg2, SWIGTYPE_p_GPS_MeasurementT_double_t, 0)))
+      && (!SWIG_IsOK(swig::asval(argv[0], (arg2 = &temp2))))){
+      SWIG_exception(SWIG_TypeError, "in method 'solve', expecting type GPS_Measurement< double >");
+    }
+  }
+  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_GPS_TimeT_double_t,  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "GPS_Time< double > const &","solve", 3, argv[1] )); 
+  }
+  if (!argp3) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_Time< double > const &","solve", 3, argv[1])); 
+  }
+  arg3 = reinterpret_cast< GPS_Time< double > * >(argp3);
+  try {
+    result = ((GPS_Solver< double > const *)arg1)->solve((GPS_Measurement< double > const &)*arg2,(GPS_Time< double > const &)*arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new GPS_User_PVT< double >(static_cast< const GPS_User_PVT< double >& >(result))), SWIGTYPE_p_GPS_User_PVTT_double_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::GPS::Solver.solve_batch
+
+  call-seq:
+    solve_batch(VALUE measurements, VALUE times) -> VALUE
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Solver_solve_batch(int argc, VALUE *argv, VALUE self) {
+  GPS_Solver< double > *arg1 = (GPS_Solver< double > *) 0 ;
+  VALUE arg2 = (VALUE) 0 ;
+  VALUE arg3 = (VALUE) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_SolverT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Solver< double > const *","solve_batch", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GPS_Solver< double > * >(argp1);
+  arg2 = argv[0];
+  arg3 = argv[1];
+  try {
+    result = (VALUE)GPS_Solver_Sl_double_Sg__solve_batch((GPS_Solver< double > const *)arg1,arg2,arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = result;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::GPS::Solver.dop_map
+
+  call-seq:
+    dop_map(VALUE receivers, VALUE satellites, VALUE options=Qnil) -> VALUE
+
+A class method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Solver_dop_map(int argc, VALUE *argv, VALUE self) {
+  VALUE arg1 = (VALUE) 0 ;
+  VALUE arg2 = (VALUE) 0 ;
+  VALUE arg3 = (VALUE) Qnil ;
+  VALUE result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 3)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GPS_SolverT_double_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GPS_Solver< double > const *","solve", 1, self )); 
-  }
-  arg1 = reinterpret_cast< GPS_Solver< double > * >(argp1);
-  {
-    if((!SWIG_IsOK(SWIG_ConvertPtr(argv[0], (void **)&arg2, SWIGTYPE_p_GPS_MeasurementT_double_t, 0)))
-      && (!SWIG_IsOK(swig::asval(argv[0], (arg2 = &temp2))))){
-      SWIG_exception(SWIG_TypeError, "in method 'solve', expecting type GPS_Measurement< double >");
-    }
-  }
-  res3 = SWIG_ConvertPtr(argv[1], &argp3, SWIGTYPE_p_GPS_TimeT_double_t,  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), Ruby_Format_TypeError( "", "GPS_Time< double > const &","solve", 3, argv[1] )); 
-  }
-  if (!argp3) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_Time< double > const &","solve", 3, argv[1])); 
+  arg1 = argv[0];
+  arg2 = argv[1];
+  if (argc > 2) {
+    arg3 = argv[2];
   }
-  arg3 = reinterpret_cast< GPS_Time< double > * >(argp3);
   try {
-    result = ((GPS_Solver< double > const *)arg1)->solve((GPS_Measurement< double > const &)*arg2,(GPS_Time< double > const &)*arg3);
+    result = (VALUE)GPS_Solver_Sl_double_Sg__dop_map(arg1,arg2,arg3);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   } catch(std::runtime_error &_e) {
     SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  vresult = SWIG_NewPointerObj((new GPS_User_PVT< double >(static_cast< const GPS_User_PVT< double >& >(result))), SWIGTYPE_p_GPS_User_PVTT_double_t, SWIG_POINTER_OWN |  0 );
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -16613,7 +18725,7 @@ fail:
   Document-method: GPS_PVT::GPS::Solver.options
 
   call-seq:
-    options -> GPS_Solver< double >::super_t::options_t
+    options -> GPS_Solver< double >::options_t
 
 An instance method.
 
@@ -16623,7 +18735,7 @@ _wrap_Solver_options(int argc, VALUE *argv, VALUE self) {
   GPS_Solver< double > *arg1 = (GPS_Solver< double > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  GPS_Solver< double >::super_t::options_t result;
+  GPS_Solver< double >::options_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -16638,6 +18750,12 @@ _wrap_Solver_options(int argc, VALUE *argv, VALUE self) {
   {
     VALUE res(rb_hash_new());
     rb_hash_aset(res, ID2SYM(rb_intern("skip_exclusion")), SWIG_From_bool  ((&result)->skip_exclusion));
+    rb_hash_aset(res, ID2SYM(rb_intern("tracking")), SWIG_From_bool  ((&result)->tracking));
+    rb_hash_aset(res, ID2SYM(rb_intern("tracking_iteration_max")), SWIG_From_int  ((&result)->tracking_iteration_max));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf")), SWIG_From_bool  ((&result)->ekf));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_acceleration")), SWIG_From_double  ((&result)->ekf_q_acceleration));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_clock")), SWIG_From_double  ((&result)->ekf_q_clock));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_clock_drift")), SWIG_From_double  ((&result)->ekf_q_clock_drift));
     vresult = res;
   }
   return vresult;
@@ -16650,7 +18768,7 @@ fail:
   Document-method: GPS_PVT::GPS::Solver.options=
 
   call-seq:
-    options=(VALUE obj) -> GPS_Solver< double >::super_t::options_t
+    options=(VALUE obj) -> GPS_Solver< double >::options_t
 
 An instance method.
 
@@ -16661,7 +18779,7 @@ _wrap_Solver_optionse___(int argc, VALUE *argv, VALUE self) {
   VALUE arg2 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  GPS_Solver< double >::super_t::options_t result;
+  GPS_Solver< double >::options_t result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -16673,10 +18791,23 @@ _wrap_Solver_optionse___(int argc, VALUE *argv, VALUE self) {
   }
   arg1 = reinterpret_cast< GPS_Solver< double > * >(argp1);
   arg2 = argv[0];
-  result = GPS_Solver_Sl_double_Sg__set_options(arg1,arg2);
+  try {
+    result = GPS_Solver_Sl_double_Sg__set_options(arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
   {
     VALUE res(rb_hash_new());
     rb_hash_aset(res, ID2SYM(rb_intern("skip_exclusion")), SWIG_From_bool  ((&result)->skip_exclusion));
+    rb_hash_aset(res, ID2SYM(rb_intern("tracking")), SWIG_From_bool  ((&result)->tracking));
+    rb_hash_aset(res, ID2SYM(rb_intern("tracking_iteration_max")), SWIG_From_int  ((&result)->tracking_iteration_max));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf")), SWIG_From_bool  ((&result)->ekf));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_acceleration")), SWIG_From_double  ((&result)->ekf_q_acceleration));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_clock")), SWIG_From_double  ((&result)->ekf_q_clock));
+    rb_hash_aset(res, ID2SYM(rb_intern("ekf_q_clock_drift")), SWIG_From_double  ((&result)->ekf_q_clock_drift));
     vresult = res;
   }
   return vresult;
@@ -18917,7 +21048,9 @@ _wrap_SpaceNode_SBAS_update_all_ephemeris(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "SBAS_SpaceNode< double >::gps_time_t const &","update_all_ephemeris", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< SBAS_SpaceNode< double >::gps_time_t * >(argp2);
+  solver_lock_t::wait(arg1);
   (arg1)->update_all_ephemeris((SBAS_SpaceNode< double >::gps_time_t const &)*arg2);
+  ephemeris_generation_t::increment(arg1);
   return Qnil;
 fail:
   return Qnil;
@@ -19185,7 +21318,7 @@ fail:
   Document-method: GPS_PVT::GPS::SpaceNode_SBAS.read
 
   call-seq:
-    read(char const * fname) -> int
+    read(std::istream & in) -> int
 
 An instance method.
 
@@ -19193,12 +21326,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_SpaceNode_SBAS_read(int argc, VALUE *argv, VALUE self) {
   SBAS_SpaceNode< double > *arg1 = (SBAS_SpaceNode< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -19210,17 +21341,29 @@ _wrap_SpaceNode_SBAS_read(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "SBAS_SpaceNode< double > *","read", 1, self )); 
   }
   arg1 = reinterpret_cast< SBAS_SpaceNode< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","read", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read", 2, argv[0] ));
+  }
+  arg2 = &(in2->in);
+  try {
+    result = (int)SBAS_SpaceNode_Sl_double_Sg__read(arg1,*arg2);
+  } catch(native_exception &_e) {
+    input_stream_t::release(in2);
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::exception &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)SBAS_SpaceNode_Sl_double_Sg__read(arg1,(char const *)arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -19991,7 +22134,9 @@ _wrap_SpaceNode_GLONASS_update_all_ephemeris(int argc, VALUE *argv, VALUE self)
     SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_Time< GLONASS_SpaceNode< double >::float_t > const &","update_all_ephemeris", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< GPS_Time< GLONASS_SpaceNode< double >::float_t > * >(argp2);
+  solver_lock_t::wait(arg1);
   (arg1)->update_all_ephemeris((GPS_Time< GLONASS_SpaceNode< double >::float_t > const &)*arg2);
+  ephemeris_generation_t::increment(arg1);
   return Qnil;
 fail:
   return Qnil;
@@ -20216,7 +22361,7 @@ fail:
   Document-method: GPS_PVT::GPS::SpaceNode_GLONASS.read
 
   call-seq:
-    read(char const * fname) -> int
+    read(std::istream & in) -> int
 
 An instance method.
 
@@ -20224,12 +22369,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_SpaceNode_GLONASS_read(int argc, VALUE *argv, VALUE self) {
   GLONASS_SpaceNode< double > *arg1 = (GLONASS_SpaceNode< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -20241,17 +22384,29 @@ _wrap_SpaceNode_GLONASS_read(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GLONASS_SpaceNode< double > *","read", 1, self )); 
   }
   arg1 = reinterpret_cast< GLONASS_SpaceNode< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","read", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read", 2, argv[0] ));
+  }
+  arg2 = &(in2->in);
+  try {
+    result = (int)GLONASS_SpaceNode_Sl_double_Sg__read(arg1,*arg2);
+  } catch(native_exception &_e) {
+    input_stream_t::release(in2);
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::exception &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)GLONASS_SpaceNode_Sl_double_Sg__read(arg1,(char const *)arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -23823,12 +25978,79 @@ fail:
   Document-method: GPS_PVT::GPS::Ephemeris_GLONASS.constellation
 
   call-seq:
+    constellation(Time t_tx, double const & dt_transit=0, bool const & use_cache=True) -> GPS_Ephemeris< double >::constellation_res_t
     constellation(Time t_tx, double const & dt_transit=0) -> GPS_Ephemeris< double >::constellation_res_t
     constellation(Time t_tx) -> GPS_Ephemeris< double >::constellation_res_t
 
 An instance method.
 
 */
+SWIGINTERN VALUE
+_wrap_Ephemeris_GLONASS_constellation__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  GLONASS_Ephemeris< double > *arg1 = (GLONASS_Ephemeris< double > *) 0 ;
+  GPS_Time< double > *arg2 = 0 ;
+  double *arg3 = 0 ;
+  bool *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  double temp3 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  bool temp4 ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  GPS_Ephemeris< double >::constellation_res_t result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_GLONASS_EphemerisT_double_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "GLONASS_Ephemeris< double > const *","constellation", 1, self )); 
+  }
+  arg1 = reinterpret_cast< GLONASS_Ephemeris< double > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_GPS_TimeT_double_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "GPS_Time< double > const &","constellation", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "GPS_Time< double > const &","constellation", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< GPS_Time< double > * >(argp2);
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","constellation", 3, argv[1] ));
+  } 
+  temp3 = static_cast< double >(val3);
+  arg3 = &temp3;
+  ecode4 = SWIG_AsVal_bool(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "bool","constellation", 4, argv[2] ));
+  } 
+  temp4 = static_cast< bool >(val4);
+  arg4 = &temp4;
+  result = GLONASS_Ephemeris_Sl_double_Sg__constellation__SWIG_0((GLONASS_Ephemeris< double > const *)arg1,(GPS_Time< double > const &)*arg2,(double const &)*arg3,(bool const &)*arg4);
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new System_XYZ<double, WGS84>((&result)->position)), 
+        SWIGTYPE_p_System_XYZT_double_WGS84_t, SWIG_POINTER_OWN))
+    
+    ;
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new System_XYZ<double, WGS84>((&result)->velocity)), 
+        SWIGTYPE_p_System_XYZT_double_WGS84_t, SWIG_POINTER_OWN))
+    
+    ;
+    vresult = SWIG_Ruby_AppendOutput(vresult, swig::from((&result)->clock_error));
+    vresult = SWIG_Ruby_AppendOutput(vresult, swig::from((&result)->clock_error_dot));
+  }
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 SWIGINTERN VALUE
 _wrap_Ephemeris_GLONASS_constellation__SWIG_0(int argc, VALUE *argv, VALUE self) {
   GLONASS_Ephemeris< double > *arg1 = (GLONASS_Ephemeris< double > *) 0 ;
@@ -23976,9 +26198,36 @@ SWIGINTERN VALUE _wrap_Ephemeris_GLONASS_constellation(int nargs, VALUE *args, V
       }
     }
   }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_GLONASS_EphemerisT_double_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_GPS_TimeT_double_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        {
+          int res = SWIG_AsVal_double(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_bool(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_Ephemeris_GLONASS_constellation__SWIG_2(nargs, args, self);
+          }
+        }
+      }
+    }
+  }
   
 fail:
   Ruby_Format_OverloadedError( argc, 4, "constellation", 
+    "    GPS_Ephemeris< double >::constellation_res_t constellation(GPS_Time< double > const &t_tx, double const &dt_transit, bool const &use_cache)\n"
     "    GPS_Ephemeris< double >::constellation_res_t constellation(GPS_Time< double > const &t_tx, double const &dt_transit)\n"
     "    GPS_Ephemeris< double >::constellation_res_t constellation(GPS_Time< double > const &t_tx)\n");
   
@@ -24180,18 +26429,16 @@ static swig_class SwigClassRINEX_Observation;
   Document-method: GPS_PVT::GPS::RINEX_Observation.read
 
   call-seq:
-    read(char const * fname)
+    read(std::istream & in)
 
 A class method.
 
 */
 SWIGINTERN VALUE
 _wrap_RINEX_Observation_read(int argc, VALUE *argv, VALUE self) {
-  char *arg1 = (char *) 0 ;
+  std::istream *arg1 = 0 ;
   void *arg2 = (void *) 0 ;
-  int res1 ;
-  char *buf1 = 0 ;
-  int alloc1 = 0 ;
+  input_stream_t *in1 = 0 ;
   
   {
     if(!rb_block_given_p()){
@@ -24202,21 +26449,151 @@ _wrap_RINEX_Observation_read(int argc, VALUE *argv, VALUE self) {
   if ((argc < 1) || (argc > 1)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_AsCharPtrAndSize(argv[0], &buf1, NULL, &alloc1);
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "char const *","RINEX_Observation_Sl_double_Sg__read", 1, argv[0] ));
+  try {
+    in1 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","RINEX_Observation_Sl_double_Sg__read", 1, argv[0] ));
+  }
+  arg1 = &(in1->in);
+  try {
+    RINEX_Observation_Sl_double_Sg__read(*arg1,(void const *)arg2);
+  } catch(native_exception &_e) {
+    delete in1; in1 = 0; // regenerate() does not return
+    (&_e)->regenerate();
+    SWIG_fail;
+  }
+  input_stream_t::release(in1);
+  return Qnil;
+fail:
+  input_stream_t::release(in1);
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::GPS::RINEX_Observation.read_measurement
+
+  call-seq:
+    read_measurement(std::istream & in, VALUE supplier=Qnil) -> int
+
+A class method.
+
+*/
+SWIGINTERN VALUE
+_wrap_RINEX_Observation_read_measurement(int argc, VALUE *argv, VALUE self) {
+  std::istream *arg1 = 0 ;
+  VALUE arg2 = (VALUE) Qnil ;
+  input_stream_t *in1 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    
+  }
+  if ((argc < 1) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  try {
+    in1 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","RINEX_Observation_Sl_double_Sg__read_measurement", 1, argv[0] ));
+  }
+  arg1 = &(in1->in);
+  if (argc > 1) {
+    arg2 = argv[1];
   }
-  arg1 = reinterpret_cast< char * >(buf1);
   try {
-    RINEX_Observation_Sl_double_Sg__read((char const *)arg1,(void const *)arg2);
+    result = (int)RINEX_Observation_Sl_double_Sg__read_measurement(*arg1,arg2);
   } catch(native_exception &_e) {
+    delete in1; in1 = 0; // regenerate() does not return
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    delete in1; in1 = 0;
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  vresult = SWIG_From_int(static_cast< int >(result));
+  input_stream_t::release(in1);
+  return vresult;
+fail:
+  input_stream_t::release(in1);
   return Qnil;
+}
+
+
+
+/*
+  Document-method: GPS_PVT::GPS::RINEX_Observation.read_packed
+
+  call-seq:
+    read_packed(std::istream & in, int const & epochs_per_block=1) -> int
+
+A class method.
+
+*/
+SWIGINTERN VALUE
+_wrap_RINEX_Observation_read_packed(int argc, VALUE *argv, VALUE self) {
+  std::istream *arg1 = 0 ;
+  int *arg2 = 0 ;
+  input_stream_t *in1 = 0 ;
+  int temp2 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int result;
+  VALUE vresult = Qnil;
+  
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    
+  }
+  if ((argc < 1) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  try {
+    in1 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","RINEX_Observation_Sl_double_Sg__read_packed", 1, argv[0] ));
+  }
+  arg1 = &(in1->in);
+  if (argc > 1) {
+    ecode2 = SWIG_AsVal_int(argv[1], &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "int","RINEX_Observation_Sl_double_Sg__read_packed", 2, argv[1] ));
+    } 
+    temp2 = static_cast< int >(val2);
+    arg2 = &temp2;
+  }
+  try {
+    result = (int)(arg2
+        ? RINEX_Observation_Sl_double_Sg__read_packed(*arg1,(int const &)*arg2)
+        : RINEX_Observation_Sl_double_Sg__read_packed(*arg1));
+  } catch(native_exception &_e) {
+    delete in1; in1 = 0; // regenerate() does not return
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    delete in1; in1 = 0;
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_From_int(static_cast< int >(result));
+  input_stream_t::release(in1);
+  return vresult;
 fail:
-  if (alloc1 == SWIG_NEWOBJ) delete[] buf1;
+  input_stream_t::release(in1);
   return Qnil;
 }
 
@@ -24280,7 +26657,7 @@ static swig_class SwigClassSP3;
   Document-method: GPS_PVT::GPS::SP3.read
 
   call-seq:
-    read(char const * fname) -> int
+    read(std::istream & in) -> int
 
 An instance method.
 
@@ -24288,12 +26665,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_SP3_read(int argc, VALUE *argv, VALUE self) {
   SP3< double > *arg1 = (SP3< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -24305,17 +26680,21 @@ _wrap_SP3_read(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "SP3< double > *","read", 1, self )); 
   }
   arg1 = reinterpret_cast< SP3< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","read", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read", 2, argv[0] ));
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)(arg1)->read((char const *)arg2);
+  arg2 = &(in2->in);
+  result = (int)(arg1)->read(*arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -24725,7 +27104,7 @@ fail:
   Document-method: GPS_PVT::GPS::SP3.apply_antex
 
   call-seq:
-    apply_antex(char const * fname) -> int
+    apply_antex(std::istream & in) -> int
 
 An instance method.
 
@@ -24733,12 +27112,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_SP3_apply_antex(int argc, VALUE *argv, VALUE self) {
   SP3< double > *arg1 = (SP3< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -24750,17 +27127,21 @@ _wrap_SP3_apply_antex(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "SP3< double > *","apply_antex", 1, self )); 
   }
   arg1 = reinterpret_cast< SP3< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","apply_antex", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","apply_antex", 2, argv[0] ));
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)(arg1)->apply_antex((char const *)arg2);
+  arg2 = &(in2->in);
+  result = (int)(arg1)->apply_antex(*arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -24824,7 +27205,7 @@ static swig_class SwigClassRINEX_Clock;
   Document-method: GPS_PVT::GPS::RINEX_Clock.read
 
   call-seq:
-    read(char const * fname) -> int
+    read(std::istream & in) -> int
 
 An instance method.
 
@@ -24832,12 +27213,10 @@ An instance method.
 SWIGINTERN VALUE
 _wrap_RINEX_Clock_read(int argc, VALUE *argv, VALUE self) {
   RINEX_Clock< double > *arg1 = (RINEX_Clock< double > *) 0 ;
-  char *arg2 = (char *) 0 ;
+  std::istream *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  int res2 ;
-  char *buf2 = 0 ;
-  int alloc2 = 0 ;
+  input_stream_t *in2 = 0 ;
   int result;
   VALUE vresult = Qnil;
   
@@ -24849,17 +27228,21 @@ _wrap_RINEX_Clock_read(int argc, VALUE *argv, VALUE self) {
     SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "RINEX_Clock< double > *","read", 1, self )); 
   }
   arg1 = reinterpret_cast< RINEX_Clock< double > * >(argp1);
-  res2 = SWIG_AsCharPtrAndSize(argv[0], &buf2, NULL, &alloc2);
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "char const *","read", 2, argv[0] ));
+  try {
+    in2 = new input_stream_t(argv[0]);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_TypeError, Ruby_Format_TypeError( "", "std::istream &","read", 2, argv[0] ));
   }
-  arg2 = reinterpret_cast< char * >(buf2);
-  result = (int)(arg1)->read((char const *)arg2);
+  arg2 = &(in2->in);
+  result = (int)(arg1)->read(*arg2);
   vresult = SWIG_From_int(static_cast< int >(result));
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return vresult;
 fail:
-  if (alloc2 == SWIG_NEWOBJ) delete[] buf2;
+  input_stream_t::release(in2);
   return Qnil;
 }
 
@@ -26035,6 +28418,8 @@ SWIGEXPORT void Init_GPS(void) {
   rb_define_method(SwigClassPVT.klass, "fd", VALUEFUNC(_wrap_PVT_fd), -1);
   rb_define_method(SwigClassPVT.klass, "fde_min", VALUEFUNC(_wrap_PVT_fde_min), -1);
   rb_define_method(SwigClassPVT.klass, "fde_2nd", VALUEFUNC(_wrap_PVT_fde_2nd), -1);
+  rb_define_method(SwigClassPVT.klass, "to_packed", VALUEFUNC(_wrap_PVT_to_packed), -1);
+  rb_define_method(SwigClassPVT.klass, "other_state", VALUEFUNC(_wrap_PVT_other_state), -1);
   SwigClassPVT.mark = 0;
   SwigClassPVT.destroy = (void (*)(void *)) free_GPS_User_PVT_Sl_double_Sg_;
   SwigClassPVT.trackObjects = 0;
@@ -26080,6 +28465,8 @@ SWIGEXPORT void Init_GPS(void) {
   rb_define_const(SwigClassMeasurement.klass, "L2CL_CARRIER_PHASE_AMBIGUITY_SCALE", SWIG_From_int(static_cast< int >(GPS_Measurement< double >::L2CL_CARRIER_PHASE_AMBIGUITY_SCALE)));
   rb_define_const(SwigClassMeasurement.klass, "ITEMS_PREDEFINED", SWIG_From_int(static_cast< int >(GPS_Measurement< double >::ITEMS_PREDEFINED)));
   rb_define_method(SwigClassMeasurement.klass, "add", VALUEFUNC(_wrap_Measurement_add), -1);
+  rb_define_method(SwigClassMeasurement.klass, "clear", VALUEFUNC(_wrap_Measurement_clear), -1);
+  rb_define_method(SwigClassMeasurement.klass, "add_packed", VALUEFUNC(_wrap_Measurement_add_packed), -1);
   rb_define_method(SwigClassMeasurement.klass, "each", VALUEFUNC(_wrap_Measurement_each), -1);
   rb_define_method(SwigClassMeasurement.klass, "to_hash", VALUEFUNC(_wrap_Measurement_to_hash), -1);
   SwigClassMeasurement.mark = 0;
@@ -26123,7 +28510,10 @@ SWIGEXPORT void Init_GPS(void) {
   rb_define_method(SwigClassSolver.klass, "sbas_options", VALUEFUNC(_wrap_Solver_sbas_options), -1);
   rb_define_method(SwigClassSolver.klass, "glonass_space_node", VALUEFUNC(_wrap_Solver_glonass_space_node), -1);
   rb_define_method(SwigClassSolver.klass, "glonass_options", VALUEFUNC(_wrap_Solver_glonass_options), -1);
+  rb_define_method(SwigClassSolver.klass, "read_rinex_nav", VALUEFUNC(_wrap_Solver_read_rinex_nav), -1);
   rb_define_method(SwigClassSolver.klass, "solve", VALUEFUNC(_wrap_Solver_solve), -1);
+  rb_define_method(SwigClassSolver.klass, "solve_batch", VALUEFUNC(_wrap_Solver_solve_batch), -1);
+  rb_define_singleton_method(SwigClassSolver.klass, "dop_map", VALUEFUNC(_wrap_Solver_dop_map), -1);
   rb_define_method(SwigClassSolver.klass, "correction", VALUEFUNC(_wrap_Solver_correction), -1);
   rb_define_method(SwigClassSolver.klass, "correction=", VALUEFUNC(_wrap_Solver_correctione___), -1);
   rb_define_method(SwigClassSolver.klass, "options", VALUEFUNC(_wrap_Solver_options), -1);
@@ -26354,6 +28744,8 @@ SWIGEXPORT void Init_GPS(void) {
   rb_define_alloc_func(SwigClassRINEX_Observation.klass, _wrap_RINEX_Observation_allocate);
   rb_define_method(SwigClassRINEX_Observation.klass, "initialize", VALUEFUNC(_wrap_new_RINEX_Observation), -1);
   rb_define_singleton_method(SwigClassRINEX_Observation.klass, "read", VALUEFUNC(_wrap_RINEX_Observation_read), -1);
+  rb_define_singleton_method(SwigClassRINEX_Observation.klass, "read_measurement", VALUEFUNC(_wrap_RINEX_Observation_read_measurement), -1);
+  rb_define_singleton_method(SwigClassRINEX_Observation.klass, "read_packed", VALUEFUNC(_wrap_RINEX_Observation_read_packed), -1);
   SwigClassRINEX_Observation.mark = 0;
   SwigClassRINEX_Observation.destroy = (void (*)(void *)) free_RINEX_Observation_Sl_double_Sg_;
   SwigClassRINEX_Observation.trackObjects = 0;
@@ -1896,6 +1896,7 @@ static VALUE mSylphideMath;
 #include <sstream>
 #include <vector>
 #include <exception>
+#include <cmath>
 
 
 #if defined(SWIGRUBY) && defined(isfinite)
@@ -3062,7 +3063,103 @@ struct MatrixUtil {
     }
     return true;
   }
+#if defined(SWIGRUBY)
+  template <class T, class Array2D_Type, class ViewType>
+  static VALUE to_binary(const Matrix_Frozen<T, Array2D_Type, ViewType> &src){
+    // row-major packed native T
+    unsigned int i_max(src.rows()), j_max(src.columns());
+    VALUE res(rb_str_new(NULL, sizeof(T) * i_max * j_max));
+    char *dst(RSTRING_PTR(res));
+    for(unsigned int i(0); i < i_max; ++i){
+      for(unsigned int j(0); j < j_max; ++j, dst += sizeof(T)){
+        T v(src(i, j));
+        std::memcpy(dst, &v, sizeof(T));
+      }
+    }
+    return res;
+  }
+  template <class T, class Array2D_Type, class ViewType>
+  static void replace_binary(
+      Matrix<T, Array2D_Type, ViewType> &dst, VALUE src){
+    // src: row-major packed native T String, or object responding to to_binary (ex. Numo::DFloat)
+    static const ID id_to_binary(rb_intern("to_binary"));
+    if((!RB_TYPE_P(src, T_STRING)) && rb_respond_to(src, id_to_binary)){
+      src = rb_funcall(src, id_to_binary, 0);
+    }
+    if(!RB_TYPE_P(src, T_STRING)){
+      throw std::invalid_argument(
+          std::string("Packed String is required: ").append(inspect_str(src)));
+    }
+    unsigned int i_max(dst.rows()), j_max(dst.columns());
+    if((std::size_t)RSTRING_LEN(src) < (sizeof(T) * i_max * j_max)){
+      throw std::invalid_argument("Length is too short");
+    }
+    const char *ptr(RSTRING_PTR(src));
+    for(unsigned int i(0); i < i_max; ++i){
+      for(unsigned int j(0); j < j_max; ++j, ptr += sizeof(T)){
+        std::memcpy(&dst(i, j), ptr, sizeof(T));
+      }
+    }
+  }
+#endif
+};
+
+#if defined(SWIGRUBY) && (RUBY_API_VERSION_CODE >= 30000)
+#include <ruby/memory_view.h>
+/*
+ * Export of real matrix as read-only 2D MemoryView (format "d").
+ * Because view based matrices are not always contiguous,
+ * a packed snapshot is made on each request, and released with the view.
+ */
+template <class ViewType>
+struct MatrixMemoryView {
+  static swig_type_info *type;
+  struct holder_t {
+    VALUE packed;
+    ssize_t shape[2], strides[2];
+  };
+  static bool get(VALUE obj, rb_memory_view_t *view, int flags){
+    if(flags & RUBY_MEMORY_VIEW_WRITABLE){return false;}
+    void *ptr(NULL);
+    if((!SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, type, 0))) || (!ptr)){return false;}
+    const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &mat(
+        *static_cast<const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> *>(ptr));
+    holder_t *holder(new holder_t());
+    holder->packed = MatrixUtil::to_binary(mat);
+    rb_gc_register_address(&holder->packed);
+    holder->shape[0] = mat.rows();
+    holder->shape[1] = mat.columns();
+    holder->strides[0] = sizeof(double) * holder->shape[1];
+    holder->strides[1] = sizeof(double);
+    rb_memory_view_init_as_byte_array(
+        view, obj, RSTRING_PTR(holder->packed), RSTRING_LEN(holder->packed), true);
+    view->format = "d";
+    view->item_size = sizeof(double);
+    view->ndim = 2;
+    view->shape = holder->shape;
+    view->strides = holder->strides;
+    view->private_data = holder;
+    return true;
+  }
+  static bool release(VALUE obj, rb_memory_view_t *view){
+    holder_t *holder(static_cast<holder_t *>(view->private_data));
+    rb_gc_unregister_address(&holder->packed);
+    delete holder;
+    return true;
+  }
+  static bool available(VALUE obj){
+    void *ptr(NULL);
+    return SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, type, 0)) && ptr;
+  }
+  static void register_class(VALUE klass, swig_type_info *type_){
+    static const rb_memory_view_entry_t entry = {get, release, available};
+    type = type_;
+    rb_memory_view_register(klass, &entry);
+  }
 };
+template <class ViewType>
+swig_type_info *MatrixMemoryView<ViewType>::type = NULL;
+#endif
 
 
 #include <limits.h>
@@ -3320,6 +3417,110 @@ SWIGINTERN std::string Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc
         return matrix_yield;
       }     
     }
+    
+    // Row-wise / whole matrix bulk variants, which yield once per row / matrix
+    template <class ViewType>
+    static VALUE matrix_row_to_binary(
+        const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &src, const unsigned int &i){
+      // packed native double String, which is unpacked by "d*" if necessary
+      unsigned int j_max(src.columns());
+      VALUE res(rb_str_new(NULL, sizeof(double) * j_max));
+      char *dst(RSTRING_PTR(res));
+      for(unsigned int j(0); j < j_max; ++j, dst += sizeof(double)){
+        double v(src(i, j));
+        std::memcpy(dst, &v, sizeof(double));
+      }
+      return res;
+    }
+    template <class ViewType>
+    static void matrix_each_row(
+        const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &src){
+      for(unsigned int i(0), i_max(src.rows()); i < i_max; ++i){
+        VALUE values[] = {matrix_row_to_binary(src, i), UINT2NUM(i)};
+        yield_throw_if_error(2, values);
+      }
+    }
+    template <class ViewType>
+    static Matrix<double, Array2D_Dense<double> > matrix_map_rows(
+        const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &src){
+      // each row is replaced with Array, or packed native double String of the same length
+      unsigned int i_max(src.rows()), j_max(src.columns());
+      Matrix<double, Array2D_Dense<double> > res(i_max, j_max);
+      for(unsigned int i(0); i < i_max; ++i){
+        VALUE values[] = {matrix_row_to_binary(src, i), UINT2NUM(i)};
+        VALUE v(yield_throw_if_error(2, values));
+        if(RB_TYPE_P(v, T_STRING)){
+          if((std::size_t)RSTRING_LEN(v) != (sizeof(double) * j_max)){
+            std::stringstream s;
+            s << "Length mismatch (" << (sizeof(double) * j_max) << " bytes expected) ["
+                << i << "]: " << RSTRING_LEN(v);
+            throw std::invalid_argument(s.str());
+          }
+          const char *ptr(RSTRING_PTR(v));
+          for(unsigned int j(0); j < j_max; ++j, ptr += sizeof(double)){
+            std::memcpy(&res(i, j), ptr, sizeof(double));
+          }
+          continue;
+        }
+        bool replaced(RB_TYPE_P(v, T_ARRAY) && ((unsigned int)RARRAY_LEN(v) == j_max));
+        for(unsigned int j(0); replaced && (j < j_max); ++j){
+          replaced = SWIG_IsOK(swig::asval(RARRAY_AREF(v, j), &res(i, j)));
+        }
+        if(!replaced){
+          std::stringstream s;
+          s << "Unknown input (Array or packed String expected) [" << i << "]: ";
+          throw std::invalid_argument(s.str().append(inspect_str(v)));
+        }
+      }
+      return res;
+    }
+    template <class ViewType>
+    static Matrix<double, Array2D_Dense<double> > matrix_map_packed(
+        const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &src){
+      unsigned int i_max(src.rows()), j_max(src.columns());
+      VALUE values[] = {MatrixUtil::to_binary(src), UINT2NUM(i_max), UINT2NUM(j_max)};
+      VALUE v(yield_throw_if_error(3, values));
+      Matrix<double, Array2D_Dense<double> > res(i_max, j_max);
+      MatrixUtil::replace_binary(res, v);
+      return res;
+    }
+    
+    // Elementwise operations completed without Ruby
+    struct matrix_op_t {
+      struct abs_t {
+        double operator()(const double &v) const {return std::abs(v);}
+      };
+      struct sqrt_t {
+        double operator()(const double &v) const {return std::sqrt(v);}
+      };
+      struct exp_t {
+        double operator()(const double &v) const {return std::exp(v);}
+      };
+      struct clamp_t {
+        double lower, upper;
+        clamp_t(const double &lower_, const double &upper_) : lower(lower_), upper(upper_) {
+          if(!(lower <= upper)){throw std::invalid_argument("Invalid range (lower > upper)");}
+        }
+        double operator()(const double &v) const {return (v < lower) ? lower : ((v > upper) ? upper : v);}
+      };
+      struct scale_t {
+        double k;
+        scale_t(const double &k_) : k(k_) {}
+        double operator()(const double &v) const {return v * k;}
+      };
+      template <class ViewType, class Func>
+      static Matrix<double, Array2D_Dense<double> > apply(
+          const Matrix_Frozen<double, Array2D_Dense<double>, ViewType> &src, const Func &func){
+        unsigned int i_max(src.rows()), j_max(src.columns());
+        Matrix<double, Array2D_Dense<double> > res(i_max, j_max);
+        for(unsigned int i(0); i < i_max; ++i){
+          for(unsigned int j(0); j < j_max; ++j){
+            res(i, j) = func(src(i, j));
+          }
+        }
+        return res;
+      }
+    };
   
 SWIGINTERN Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__each__SWIG_0(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self,void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &),MatrixUtil::each_which_t const each_which=MatrixUtil::EACH_ALL){
     MatrixUtil::each(*self, each_func, each_which);
@@ -3356,6 +3557,33 @@ SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatVi
     }
     return res;
   }
+SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__to_binary(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return MatrixUtil::to_binary(*self);
+  }
+SWIGINTERN void Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__each_row(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    matrix_each_row(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__map_rows(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return matrix_map_rows(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__map_packed(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return matrix_map_packed(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__abs(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::abs_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__sqrt(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::sqrt_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__exp(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::exp_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__clamp(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self,double const &lower,double const &upper){
+    return matrix_op_t::apply(*self, matrix_op_t::clamp_t(lower, upper));
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__scale(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self,double const &k){
+    return matrix_op_t::apply(*self, matrix_op_t::scale_t(k));
+  }
 SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__to_shareable(Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *self){
     Matrix_Frozen<double, Array2D_Dense< double >, MatrixViewBase< > > *ptr(
         new Matrix_Frozen<double, Array2D_Dense< double >, MatrixViewBase< > >(*self));
@@ -3570,6 +3798,33 @@ SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatVi
     }
     return res;
   }
+SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__to_binary(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return MatrixUtil::to_binary(*self);
+  }
+SWIGINTERN void Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each_row(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    matrix_each_row(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map_rows(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return matrix_map_rows(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map_packed(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return matrix_map_packed(*self);
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__abs(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::abs_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__sqrt(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::sqrt_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__exp(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
+    return matrix_op_t::apply(*self, matrix_op_t::exp_t());
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__clamp(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self,double const &lower,double const &upper){
+    return matrix_op_t::apply(*self, matrix_op_t::clamp_t(lower, upper));
+  }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__scale(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self,double const &k){
+    return matrix_op_t::apply(*self, matrix_op_t::scale_t(k));
+  }
 SWIGINTERN VALUE Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__to_shareable(Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *self){
     Matrix_Frozen<double, Array2D_Dense< double >, MatrixViewFilter< MatrixViewBase< > > > *ptr(
         new Matrix_Frozen<double, Array2D_Dense< double >, MatrixViewFilter< MatrixViewBase< > > >(*self));
@@ -3686,6 +3941,11 @@ SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Sl_double_Sc_Array2D_
     return Matrix<double, Array2D_Dense<double> >(
         Matrix_Frozen<double, Array2D_Dense< double >, MatrixViewBase< >>::getI(size));
   }
+SWIGINTERN Matrix< double,Array2D_Dense< double > > Matrix_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sg__from_binary(unsigned int const &rows,unsigned int const &columns,VALUE packed){
+    Matrix<double, Array2D_Dense< double >, MatrixViewBase< >> res(rows, columns);
+    MatrixUtil::replace_binary(res, packed);
+    return res;
+  }
 SWIGINTERN void Matrix_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sg__swap_rows(Matrix< double,Array2D_Dense< double > > *self,Matrix< double,Array2D_Dense< double > >::self_t *self_p,unsigned int const &r1,unsigned int const &r2){
     self->swapRows(r1, r2);
   }
@@ -9027,16 +9287,15 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.to_shareable
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.to_binary
 
   call-seq:
-    to_shareable -> VALUE
-
-An instance method.
+    to_binary -> VALUE
 
+Convert Matrix_FrozenD to a row-major packed native double String.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_to_shareable(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_to_binary(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -9048,10 +9307,10 @@ _wrap_Matrix_FrozenD_to_shareable(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","to_shareable", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","to_binary", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__to_shareable((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__to_binary((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
   vresult = result;
   return vresult;
 fail:
@@ -9060,32 +9319,40 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.to_s
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.each_row
 
   call-seq:
-    to_s -> std::string
-
-An instance method.
+    each_row -> Matrix_FrozenD
 
+Yield each row as a packed native double String ("d*") with its index, once per row.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD___str__(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_each_row(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::string result;
   VALUE vresult = Qnil;
   
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+  }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","__str__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","each_row", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg____str__((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
-  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  try {
+    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__each_row((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = self;
   return vresult;
 fail:
   return Qnil;
@@ -9093,32 +9360,41 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.conjugate
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.map_rows
 
   call-seq:
-    conjugate -> Matrix_FrozenD_f
-
-An instance method.
+    map_rows -> MatrixD
 
+Build a new matrix from rows returned as Array or packed String, once per row.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_conjugate(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_map_rows(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+  }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","conjugate", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","map_rows", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__conjugate((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__map_rows((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9126,32 +9402,42 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.adjoint
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.map_packed
 
   call-seq:
-    adjoint -> Matrix_FrozenD_f
-
-An instance method.
+    map_packed -> MatrixD
 
+Yield a row-major packed native double String with rows and columns once,
+and build a new matrix from the returned packed String.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_adjoint(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_map_packed(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+  }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","adjoint", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","map_packed", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__adjoint((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__map_packed((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9159,20 +9445,19 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.transpose
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.abs
 
   call-seq:
-    transpose -> Matrix_FrozenD_f
-
-An instance method.
+    abs -> MatrixD
 
+Elementwise absolute value without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_transpose(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_abs(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -9180,11 +9465,18 @@ _wrap_Matrix_FrozenD_transpose(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","transpose", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","abs", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__transpose((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__abs((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9192,251 +9484,136 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.partial
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.sqrt
 
   call-seq:
-    partial(unsigned int const & new_rows, unsigned int const & new_columns, unsigned int const & row_offset, 
-    unsigned int const & column_offset) -> Matrix_FrozenD_f
-    partial(unsigned int const & new_rows, unsigned int const & new_columns) -> Matrix_FrozenD_f
-
-An instance method.
+    sqrt -> MatrixD
 
+Elementwise square root without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_partial__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_sqrt(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
-  unsigned int *arg4 = 0 ;
-  unsigned int *arg5 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  unsigned int temp4 ;
-  unsigned int val4 ;
-  int ecode4 = 0 ;
-  unsigned int temp5 ;
-  unsigned int val5 ;
-  int ecode5 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 4) || (argc > 4)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","partial", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","sqrt", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","partial", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","partial", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  ecode4 = SWIG_AsVal_unsigned_SS_int(argv[2], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "unsigned int","partial", 4, argv[2] ));
-  } 
-  temp4 = static_cast< unsigned int >(val4);
-  arg4 = &temp4;
-  ecode5 = SWIG_AsVal_unsigned_SS_int(argv[3], &val5);
-  if (!SWIG_IsOK(ecode5)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "unsigned int","partial", 5, argv[3] ));
-  } 
-  temp5 = static_cast< unsigned int >(val5);
-  arg5 = &temp5;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  raise_if_lt_zero_after_asval(*arg4);
-  raise_if_lt_zero_after_asval(*arg5);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__partial__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3,(unsigned int const &)*arg4,(unsigned int const &)*arg5);
-  } catch(std::out_of_range &_e) {
-    SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__sqrt((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.exp
+
+  call-seq:
+    exp -> MatrixD
+
+Elementwise exponential without Ruby block.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_partial__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_exp(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","partial", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","exp", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","partial", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","partial", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__partial__SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
-  } catch(std::out_of_range &_e) {
-    SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__exp((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_partial(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[6];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 6) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 3) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        {
-          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          return _wrap_Matrix_FrozenD_partial__SWIG_1(nargs, args, self);
-        }
-      }
-    }
-  }
-  if (argc == 5) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        {
-          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          {
-            int res = SWIG_AsVal_unsigned_SS_int(argv[3], NULL);
-            _v = SWIG_CheckState(res);
-          }
-          if (_v) {
-            {
-              int res = SWIG_AsVal_unsigned_SS_int(argv[4], NULL);
-              _v = SWIG_CheckState(res);
-            }
-            if (_v) {
-              return _wrap_Matrix_FrozenD_partial__SWIG_0(nargs, args, self);
-            }
-          }
-        }
-      }
-    }
-  }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 6, "partial", 
-    "    Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > partial(unsigned int const &new_rows, unsigned int const &new_columns, unsigned int const &row_offset, unsigned int const &column_offset)\n"
-    "    Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > partial(unsigned int const &new_rows, unsigned int const &new_columns)\n");
-  
-  return Qnil;
-}
-
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.row_vector
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.clamp
 
   call-seq:
-    row_vector(unsigned int const & row) -> Matrix_FrozenD_f
-
-An instance method.
+    clamp(double const & lower, double const & upper) -> MatrixD
 
+Elementwise clamp into [lower, upper] without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_row_vector(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_clamp(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
-  unsigned int *arg2 = 0 ;
+  double *arg2 = 0 ;
+  double *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
+  double temp2 ;
+  double val2 ;
   int ecode2 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  double temp3 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","row_vector", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","clamp", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","row_vector", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","clamp", 2, argv[0] ));
   } 
-  temp2 = static_cast< unsigned int >(val2);
+  temp2 = static_cast< double >(val2);
   arg2 = &temp2;
-  raise_if_lt_zero_after_asval(*arg2);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__row_vector((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2);
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","clamp", 3, argv[1] ));
+  } 
+  temp3 = static_cast< double >(val3);
+  arg3 = &temp3;
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__clamp((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(double const &)*arg2,(double const &)*arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9444,24 +9621,23 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.column_vector
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.scale
 
   call-seq:
-    column_vector(unsigned int const & column) -> Matrix_FrozenD_f
-
-An instance method.
+    scale(double const & k) -> MatrixD
 
+Elementwise multiplication by k without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_column_vector(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_scale(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
-  unsigned int *arg2 = 0 ;
+  double *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
+  double temp2 ;
+  double val2 ;
   int ecode2 = 0 ;
-  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -9469,18 +9645,24 @@ _wrap_Matrix_FrozenD_column_vector(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","column_vector", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","scale", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","column_vector", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","scale", 2, argv[0] ));
   } 
-  temp2 = static_cast< unsigned int >(val2);
+  temp2 = static_cast< double >(val2);
   arg2 = &temp2;
-  raise_if_lt_zero_after_asval(*arg2);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__column_vector((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2);
-  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__scale((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(double const &)*arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9488,101 +9670,65 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.eigen
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.to_shareable
 
   call-seq:
-    eigen
+    to_shareable -> VALUE
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_eigen(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_to_shareable(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
-  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > *arg2 = 0 ;
-  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > temp2 ;
-  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > temp3 ;
+  VALUE result;
   VALUE vresult = Qnil;
   
-  
-  arg2 = &temp2;
-  
-  
-  arg3 = &temp3;
-  
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","eigen", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","to_shareable", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
-  try {
-    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__eigen((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,*arg2,*arg3);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = rb_ary_new();
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< Complex< double >,Array2D_Dense< Complex< double > > >(*arg2)), SWIGTYPE_p_MatrixT_ComplexT_double_t_Array2D_DenseT_ComplexT_double_t_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
-  }
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< Complex< double >,Array2D_Dense< Complex< double > > >(*arg3)), SWIGTYPE_p_MatrixT_ComplexT_double_t_Array2D_DenseT_ComplexT_double_t_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
-  }
+  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__to_shareable((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN void
-free_Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg_(void *self) {
-    Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *)self;
-    delete arg1;
-}
-
-/*
-  Document-class: GPS_PVT::SylphideMath::Matrix_FrozenD_f
-
-  Proxy of C++ GPS_PVT::SylphideMath::Matrix_FrozenD_f class
-
-
-*/
-static swig_class SwigClassMatrix_FrozenD_f;
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.rows
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.to_s
 
   call-seq:
-    rows -> unsigned int const
+    to_s -> std::string
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_rows(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD___str__(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int result;
+  std::string result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *","rows", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","__str__", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (unsigned int)(arg1)->rows();
-  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg____str__((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
   return vresult;
 fail:
   return Qnil;
@@ -9590,32 +9736,32 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.columns
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.conjugate
 
   call-seq:
-    columns -> unsigned int const
+    conjugate -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_columns(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_conjugate(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int result;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *","columns", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","conjugate", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (unsigned int)(arg1)->columns();
-  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__conjugate((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9623,32 +9769,32 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.square?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.adjoint
 
   call-seq:
-    square? -> bool
+    adjoint -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_squareq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_adjoint(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSquare", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","adjoint", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSquare();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__adjoint((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9656,32 +9802,32 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.diagonal?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.transpose
 
   call-seq:
-    diagonal? -> bool
+    transpose -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_diagonalq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_transpose(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDiagonal", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","transpose", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isDiagonal();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__transpose((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1);
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9689,131 +9835,251 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.lower_triangular?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.partial
 
   call-seq:
-    lower_triangular? -> bool
+    partial(unsigned int const & new_rows, unsigned int const & new_columns, unsigned int const & row_offset, 
+    unsigned int const & column_offset) -> Matrix_FrozenD_f
+    partial(unsigned int const & new_rows, unsigned int const & new_columns) -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_lower_triangularq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_partial__SWIG_0(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
+  unsigned int *arg4 = 0 ;
+  unsigned int *arg5 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  unsigned int temp4 ;
+  unsigned int val4 ;
+  int ecode4 = 0 ;
+  unsigned int temp5 ;
+  unsigned int val5 ;
+  int ecode5 = 0 ;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isLowerTriangular", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","partial", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isLowerTriangular();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","partial", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","partial", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  ecode4 = SWIG_AsVal_unsigned_SS_int(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "unsigned int","partial", 4, argv[2] ));
+  } 
+  temp4 = static_cast< unsigned int >(val4);
+  arg4 = &temp4;
+  ecode5 = SWIG_AsVal_unsigned_SS_int(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "unsigned int","partial", 5, argv[3] ));
+  } 
+  temp5 = static_cast< unsigned int >(val5);
+  arg5 = &temp5;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  raise_if_lt_zero_after_asval(*arg4);
+  raise_if_lt_zero_after_asval(*arg5);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__partial__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3,(unsigned int const &)*arg4,(unsigned int const &)*arg5);
+  } catch(std::out_of_range &_e) {
+    SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.upper_triangular?
-
-  call-seq:
-    upper_triangular? -> bool
-
-An instance method.
-
-*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_upper_triangularq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_partial__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isUpperTriangular", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","partial", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isUpperTriangular();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","partial", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","partial", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__partial__SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
+  } catch(std::out_of_range &_e) {
+    SWIG_exception_fail(SWIG_IndexError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.symmetric?
-
-  call-seq:
-    symmetric? -> bool
-
-An instance method.
-
-*/
-SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_symmetricq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  bool result;
-  VALUE vresult = Qnil;
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_partial(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 6) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSymmetric", 1, self )); 
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_Matrix_FrozenD_partial__SWIG_1(nargs, args, self);
+        }
+      }
+    }
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSymmetric();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
-  return vresult;
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_unsigned_SS_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_unsigned_SS_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_Matrix_FrozenD_partial__SWIG_0(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  
 fail:
+  Ruby_Format_OverloadedError( argc, 6, "partial", 
+    "    Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > partial(unsigned int const &new_rows, unsigned int const &new_columns, unsigned int const &row_offset, unsigned int const &column_offset)\n"
+    "    Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > partial(unsigned int const &new_rows, unsigned int const &new_columns)\n");
+  
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.hermitian?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.row_vector
 
   call-seq:
-    hermitian? -> bool
+    row_vector(unsigned int const & row) -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_hermitianq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_row_vector(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
+  unsigned int *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isHermitian", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","row_vector", 1, self )); 
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isHermitian();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","row_vector", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  raise_if_lt_zero_after_asval(*arg2);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__row_vector((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2);
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -9821,53 +10087,133 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.skew_symmetric?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.column_vector
 
   call-seq:
-    skew_symmetric? -> bool
+    column_vector(unsigned int const & column) -> Matrix_FrozenD_f
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_skew_symmetricq___(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+_wrap_Matrix_FrozenD_column_vector(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
+  unsigned int *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","column_vector", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","column_vector", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  raise_if_lt_zero_after_asval(*arg2);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__column_vector((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,(unsigned int const &)*arg2);
+  vresult = SWIG_NewPointerObj((new Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >(static_cast< const Matrix_Frozen< double,Array2D_Dense< double >,MatView_f >& >(result))), SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD.eigen
+
+  call-seq:
+    eigen
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_eigen(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *) 0 ;
+  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > *arg2 = 0 ;
+  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > temp2 ;
+  Matrix< Complex< double >,Array2D_Dense< Complex< double > > > temp3 ;
   VALUE vresult = Qnil;
   
+  
+  arg2 = &temp2;
+  
+  
+  arg3 = &temp3;
+  
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSkewSymmetric", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > const *","eigen", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > * >(argp1);
+  try {
+    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg__eigen((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const *)arg1,*arg2,*arg3);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = rb_ary_new();
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< Complex< double >,Array2D_Dense< Complex< double > > >(*arg2)), SWIGTYPE_p_MatrixT_ComplexT_double_t_Array2D_DenseT_ComplexT_double_t_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< Complex< double >,Array2D_Dense< Complex< double > > >(*arg3)), SWIGTYPE_p_MatrixT_ComplexT_double_t_Array2D_DenseT_ComplexT_double_t_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
   }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSkewSymmetric();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
+SWIGINTERN void
+free_Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatViewBase_Sg_(void *self) {
+    Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatViewBase > *)self;
+    delete arg1;
+}
+
+/*
+  Document-class: GPS_PVT::SylphideMath::Matrix_FrozenD_f
+
+  Proxy of C++ GPS_PVT::SylphideMath::Matrix_FrozenD_f class
+
+
+*/
+static swig_class SwigClassMatrix_FrozenD_f;
+
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.normal?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.rows
 
   call-seq:
-    normal? -> bool
+    rows -> unsigned int const
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_normalq___(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_rows(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -9875,11 +10221,11 @@ _wrap_Matrix_FrozenD_f_normalq___(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isNormal", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *","rows", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isNormal();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  result = (unsigned int)(arg1)->rows();
+  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
   return vresult;
 fail:
   return Qnil;
@@ -9887,20 +10233,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.orthogonal?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.columns
 
   call-seq:
-    orthogonal? -> bool
+    columns -> unsigned int const
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_orthogonalq___(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_columns(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  bool result;
+  unsigned int result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -9908,11 +10254,11 @@ _wrap_Matrix_FrozenD_f_orthogonalq___(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isOrthogonal", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *","columns", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isOrthogonal();
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  result = (unsigned int)(arg1)->columns();
+  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
   return vresult;
 fail:
   return Qnil;
@@ -9920,16 +10266,16 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.unitary?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.square?
 
   call-seq:
-    unitary? -> bool
+    square? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_unitaryq___(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_squareq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -9941,10 +10287,10 @@ _wrap_Matrix_FrozenD_f_unitaryq___(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isUnitary", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSquare", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isUnitary();
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSquare();
   vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
@@ -9953,20 +10299,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.trace
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.diagonal?
 
   call-seq:
-    trace -> double
+    diagonal? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_trace(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_diagonalq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -9974,15 +10320,11 @@ _wrap_Matrix_FrozenD_f_trace(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","trace", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDiagonal", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  try {
-    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->trace();
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = SWIG_From_double(static_cast< double >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isDiagonal();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -9990,20 +10332,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.sum
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.lower_triangular?
 
   call-seq:
-    sum -> double
+    lower_triangular? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_sum(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_lower_triangularq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -10011,11 +10353,11 @@ _wrap_Matrix_FrozenD_f_sum(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","sum", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isLowerTriangular", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->sum();
-  vresult = SWIG_From_double(static_cast< double >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isLowerTriangular();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10023,20 +10365,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.determinant
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.upper_triangular?
 
   call-seq:
-    determinant -> double
+    upper_triangular? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_determinant(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_upper_triangularq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -10044,17 +10386,11 @@ _wrap_Matrix_FrozenD_f_determinant(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","determinant", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isUpperTriangular", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  try {
-    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->determinant();
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = SWIG_From_double(static_cast< double >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isUpperTriangular();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10062,20 +10398,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.rank
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.symmetric?
 
   call-seq:
-    rank -> unsigned int
+    symmetric? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_rank(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_symmetricq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -10083,15 +10419,11 @@ _wrap_Matrix_FrozenD_f_rank(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","rank", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSymmetric", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  try {
-    result = (unsigned int)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->rank();
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSymmetric();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10099,60 +10431,32 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.cofactor
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.hermitian?
 
   call-seq:
-    cofactor(unsigned int const & row, unsigned int const & column) -> double
+    hermitian? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_cofactor(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_hermitianq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  double result;
+  bool result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","cofactor", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isHermitian", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","cofactor", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","cofactor", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  try {
-    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->cofactor((unsigned int const &)*arg2,(unsigned int const &)*arg3);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = SWIG_From_double(static_cast< double >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isHermitian();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10160,53 +10464,32 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.[]
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.skew_symmetric?
 
   call-seq:
-    [](row, column) -> double
+    skew_symmetric? -> bool
+
+An instance method.
 
-Element accessor/slicing.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___getitem__(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_skew_symmetricq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  double result;
+  bool result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","__getitem__", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isSkewSymmetric", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","__getitem__", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","__getitem__", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  result = (double)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg____getitem__((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
-  vresult = SWIG_From_double(static_cast< double >(result));
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isSkewSymmetric();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10214,20 +10497,20 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.copy
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.normal?
 
   call-seq:
-    copy -> MatrixD
+    normal? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_copy(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_normalq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -10235,11 +10518,11 @@ _wrap_Matrix_FrozenD_f_copy(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","copy", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isNormal", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__copy((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isNormal();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10247,500 +10530,358 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.circular
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.orthogonal?
 
   call-seq:
-    circular(unsigned int const & row_offset, unsigned int const & column_offset, unsigned int const & new_rows, 
-    unsigned int const & new_columns) -> MatrixD
-    circular(unsigned int const & row_offset, unsigned int const & column_offset) -> MatrixD
+    orthogonal? -> bool
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_circular__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_orthogonalq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
-  unsigned int *arg4 = 0 ;
-  unsigned int *arg5 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  unsigned int temp4 ;
-  unsigned int val4 ;
-  int ecode4 = 0 ;
-  unsigned int temp5 ;
-  unsigned int val5 ;
-  int ecode5 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
-  if ((argc < 4) || (argc > 4)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","circular", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isOrthogonal", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","circular", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","circular", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  ecode4 = SWIG_AsVal_unsigned_SS_int(argv[2], &val4);
-  if (!SWIG_IsOK(ecode4)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "unsigned int","circular", 4, argv[2] ));
-  } 
-  temp4 = static_cast< unsigned int >(val4);
-  arg4 = &temp4;
-  ecode5 = SWIG_AsVal_unsigned_SS_int(argv[3], &val5);
-  if (!SWIG_IsOK(ecode5)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "unsigned int","circular", 5, argv[3] ));
-  } 
-  temp5 = static_cast< unsigned int >(val5);
-  arg5 = &temp5;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  raise_if_lt_zero_after_asval(*arg4);
-  raise_if_lt_zero_after_asval(*arg5);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__circular__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3,(unsigned int const &)*arg4,(unsigned int const &)*arg5);
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isOrthogonal();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.unitary?
+
+  call-seq:
+    unitary? -> bool
+
+An instance method.
+
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_circular__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_unitaryq___(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","circular", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isUnitary", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","circular", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","circular", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__circular__SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->isUnitary();
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_circular(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[6];
-  int ii;
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.trace
+
+  call-seq:
+    trace -> double
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_trace(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double result;
+  VALUE vresult = Qnil;
   
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 6) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (argc == 3) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        {
-          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          return _wrap_Matrix_FrozenD_f_circular__SWIG_1(nargs, args, self);
-        }
-      }
-    }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","trace", 1, self )); 
   }
-  if (argc == 5) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        {
-          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
-          _v = SWIG_CheckState(res);
-        }
-        if (_v) {
-          {
-            int res = SWIG_AsVal_unsigned_SS_int(argv[3], NULL);
-            _v = SWIG_CheckState(res);
-          }
-          if (_v) {
-            {
-              int res = SWIG_AsVal_unsigned_SS_int(argv[4], NULL);
-              _v = SWIG_CheckState(res);
-            }
-            if (_v) {
-              return _wrap_Matrix_FrozenD_f_circular__SWIG_0(nargs, args, self);
-            }
-          }
-        }
-      }
-    }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->trace();
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  
+  vresult = SWIG_From_double(static_cast< double >(result));
+  return vresult;
 fail:
-  Ruby_Format_OverloadedError( argc, 6, "circular", 
-    "    Matrix< double,Array2D_Dense< double > > circular(unsigned int const &row_offset, unsigned int const &column_offset, unsigned int const &new_rows, unsigned int const &new_columns)\n"
-    "    Matrix< double,Array2D_Dense< double > > circular(unsigned int const &row_offset, unsigned int const &column_offset)\n");
-  
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.==
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.sum
 
   call-seq:
-    ==(matrix) -> bool
-    ==(matrix) -> bool
+    sum -> double
+
+An instance method.
 
-Equality comparison operator.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___eq____SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_sum(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  bool result;
+  double result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","sum", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->SWIGTEMPLATEDISAMBIGUATOR operator ==((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->sum();
+  vresult = SWIG_From_double(static_cast< double >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.determinant
+
+  call-seq:
+    determinant -> double
+
+An instance method.
+
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___eq____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_determinant(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  bool result;
+  double result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","determinant", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+  try {
+    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->determinant();
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
-  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->SWIGTEMPLATEDISAMBIGUATOR operator ==((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  vresult = SWIG_From_double(static_cast< double >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___eq__(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[3];
-  int ii;
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.rank
+
+  call-seq:
+    rank -> unsigned int
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_rank(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int result;
+  VALUE vresult = Qnil;
   
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 3) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f___eq____SWIG_1(nargs, args, self);
-      }
-    }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","rank", 1, self )); 
   }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f___eq____SWIG_2(nargs, args, self);
-      }
-    }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    result = (unsigned int)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->rank();
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  
+  vresult = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return vresult;
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "__eq__", 
-    "    bool __eq__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    bool __eq__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
-  
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.different_size?
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.cofactor
 
   call-seq:
-    different_size?(Matrix_FrozenD matrix) -> bool
-    different_size?(Matrix_FrozenD_f matrix) -> bool
+    cofactor(unsigned int const & row, unsigned int const & column) -> double
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_cofactor(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  double result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","cofactor", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","cofactor", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","cofactor", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  try {
+    result = (double)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->cofactor((unsigned int const &)*arg2,(unsigned int const &)*arg3);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
-  result = (bool)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__isDifferentSize_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  vresult = SWIG_From_double(static_cast< double >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.[]
+
+  call-seq:
+    [](row, column) -> double
+
+Element accessor/slicing.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___getitem__(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  bool result;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  double result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","__getitem__", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
-  result = (bool)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__isDifferentSize_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  vresult = SWIG_From_bool(static_cast< bool >(result));
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","__getitem__", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","__getitem__", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  result = (double)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg____getitem__((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
+  vresult = SWIG_From_double(static_cast< double >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_different_sizeq___(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[3];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 3) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_1(nargs, args, self);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_2(nargs, args, self);
-      }
-    }
-  }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 3, "different_size?", 
-    "    bool different_size?(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    bool different_size?(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
-  
-  return Qnil;
-}
-
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.copy
 
   call-seq:
-    *(double const & scalar) -> MatrixD
-    *(Matrix_FrozenD matrix) -> MatrixD
-    *(Matrix_FrozenD_f matrix) -> MatrixD
+    copy -> MatrixD
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___mul____SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_copy(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  double *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2 ;
-  double val2 ;
-  int ecode2 = 0 ;
   SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","copy", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_double(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator *", 2, argv[0] ));
-  } 
-  temp2 = static_cast< double >(val2);
-  arg2 = &temp2;
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm___SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__copy((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
@@ -10749,43 +10890,77 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f./
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.circular
 
   call-seq:
-    /(double const & scalar) -> MatrixD
-    /(Matrix_FrozenD matrix) -> MatrixD
-    /(Matrix_FrozenD_f matrix) -> MatrixD
+    circular(unsigned int const & row_offset, unsigned int const & column_offset, unsigned int const & new_rows, 
+    unsigned int const & new_columns) -> MatrixD
+    circular(unsigned int const & row_offset, unsigned int const & column_offset) -> MatrixD
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___div____SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_circular__SWIG_0(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  double *arg2 = 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
+  unsigned int *arg4 = 0 ;
+  unsigned int *arg5 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2 ;
-  double val2 ;
+  unsigned int temp2 ;
+  unsigned int val2 ;
   int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  unsigned int temp4 ;
+  unsigned int val4 ;
+  int ecode4 = 0 ;
+  unsigned int temp5 ;
+  unsigned int val5 ;
+  int ecode5 = 0 ;
   SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 4) || (argc > 4)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 4)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","circular", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator /", 2, argv[0] ));
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","circular", 2, argv[0] ));
   } 
-  temp2 = static_cast< double >(val2);
+  temp2 = static_cast< unsigned int >(val2);
   arg2 = &temp2;
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd___SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","circular", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  ecode4 = SWIG_AsVal_unsigned_SS_int(argv[2], &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), Ruby_Format_TypeError( "", "unsigned int","circular", 4, argv[2] ));
+  } 
+  temp4 = static_cast< unsigned int >(val4);
+  arg4 = &temp4;
+  ecode5 = SWIG_AsVal_unsigned_SS_int(argv[3], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), Ruby_Format_TypeError( "", "unsigned int","circular", 5, argv[3] ));
+  } 
+  temp5 = static_cast< unsigned int >(val5);
+  arg5 = &temp5;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  raise_if_lt_zero_after_asval(*arg4);
+  raise_if_lt_zero_after_asval(*arg5);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__circular__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3,(unsigned int const &)*arg4,(unsigned int const &)*arg5);
   vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
@@ -10793,35 +10968,45 @@ fail:
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.-@
-
-  call-seq:
-    -@ -> MatrixD
-
-Substraction operator.
-*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___neg__(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_circular__SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
   SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","circular", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss_((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","circular", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","circular", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__circular__SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
   vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
@@ -10829,64 +11014,99 @@ fail:
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.+
-
-  call-seq:
-    +(matrix) -> MatrixD
-    +(matrix) -> MatrixD
-    +(scalar) -> MatrixD
-
-Add operator.
-*/
-SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___add____SWIG_1(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
-  VALUE vresult = Qnil;
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_circular(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[6];
+  int ii;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
-  }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 6) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
-  return vresult;
-fail:
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_Matrix_FrozenD_f_circular__SWIG_1(nargs, args, self);
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_unsigned_SS_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_unsigned_SS_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          {
+            int res = SWIG_AsVal_unsigned_SS_int(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            {
+              int res = SWIG_AsVal_unsigned_SS_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_Matrix_FrozenD_f_circular__SWIG_0(nargs, args, self);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 6, "circular", 
+    "    Matrix< double,Array2D_Dense< double > > circular(unsigned int const &row_offset, unsigned int const &column_offset, unsigned int const &new_rows, unsigned int const &new_columns)\n"
+    "    Matrix< double,Array2D_Dense< double > > circular(unsigned int const &row_offset, unsigned int const &column_offset)\n");
+  
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.==
+
+  call-seq:
+    ==(matrix) -> bool
+    ==(matrix) -> bool
+
+Equality comparison operator.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___add____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___eq____SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 ;
   int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -10894,23 +11114,19 @@ _wrap_Matrix_FrozenD_f___add____SWIG_2(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
-  }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator ==<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->SWIGTEMPLATEDISAMBIGUATOR operator ==((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -10918,15 +11134,14 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___add____SWIG_3(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___eq____SWIG_2(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  double *arg2 = 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double temp2 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  void *argp2 ;
+  int res2 = 0 ;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -10934,28 +11149,26 @@ _wrap_Matrix_FrozenD_f___add____SWIG_3(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_double(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator +", 2, argv[0] ));
-  } 
-  temp2 = static_cast< double >(val2);
-  arg2 = &temp2;
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator ==<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
+  result = (bool)((Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *)arg1)->SWIGTEMPLATEDISAMBIGUATOR operator ==((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___add__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___eq__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[3];
   int ii;
@@ -10976,7 +11189,7 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___add__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___add____SWIG_1(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___eq____SWIG_1(nargs, args, self);
       }
     }
   }
@@ -10990,55 +11203,39 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___add__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___add____SWIG_2(nargs, args, self);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_double(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f___add____SWIG_3(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___eq____SWIG_2(nargs, args, self);
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "__add__", 
-    "    Matrix< double,Array2D_Dense< double > > __add__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __add__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __add__(double const &scalar)\n");
+  Ruby_Format_OverloadedError( argc, 3, "__eq__", 
+    "    bool __eq__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    bool __eq__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
   
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.-
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.different_size?
 
   call-seq:
-    -(matrix) -> MatrixD
-    -(matrix) -> MatrixD
-    -(scalar) -> MatrixD
+    different_size?(Matrix_FrozenD matrix) -> bool
+    different_size?(Matrix_FrozenD_f matrix) -> bool
+
+An instance method.
 
-Substraction operator.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___sub____SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 ;
   int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -11046,23 +11243,19 @@ _wrap_Matrix_FrozenD_f___sub____SWIG_1(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = (bool)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__isDifferentSize_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
@@ -11070,14 +11263,14 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___sub____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_2(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   void *argp2 ;
   int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  bool result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -11085,68 +11278,26 @@ _wrap_Matrix_FrozenD_f___sub____SWIG_2(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","isDifferentSize<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
-  return vresult;
-fail:
-  return Qnil;
-}
-
-
-SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___sub____SWIG_3(int argc, VALUE *argv, VALUE self) {
-  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  double *arg2 = 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  double temp2 ;
-  double val2 ;
-  int ecode2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
-  VALUE vresult = Qnil;
-  
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
-  }
-  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -", 1, self )); 
-  }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_double(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator -", 2, argv[0] ));
-  } 
-  temp2 = static_cast< double >(val2);
-  arg2 = &temp2;
-  try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
-  }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = (bool)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__isDifferentSize_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  vresult = SWIG_From_bool(static_cast< bool >(result));
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___sub__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_different_sizeq___(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[3];
   int ii;
@@ -11167,7 +11318,7 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___sub__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___sub____SWIG_1(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_1(nargs, args, self);
       }
     }
   }
@@ -11181,48 +11332,158 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___sub__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___sub____SWIG_2(nargs, args, self);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        int res = SWIG_AsVal_double(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f___sub____SWIG_3(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f_different_sizeq_____SWIG_2(nargs, args, self);
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "__sub__", 
-    "    Matrix< double,Array2D_Dense< double > > __sub__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __sub__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __sub__(double const &scalar)\n");
+  Ruby_Format_OverloadedError( argc, 3, "different_size?", 
+    "    bool different_size?(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    bool different_size?(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
   
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.entrywise_product
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.*
 
   call-seq:
-    entrywise_product(Matrix_FrozenD matrix) -> MatrixD
-    entrywise_product(Matrix_FrozenD_f matrix) -> MatrixD
+    *(double const & scalar) -> MatrixD
+    *(Matrix_FrozenD matrix) -> MatrixD
+    *(Matrix_FrozenD_f matrix) -> MatrixD
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_entrywise_product__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___mul____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  double *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator *", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm___SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f./
+
+  call-seq:
+    /(double const & scalar) -> MatrixD
+    /(Matrix_FrozenD matrix) -> MatrixD
+    /(Matrix_FrozenD_f matrix) -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___div____SWIG_0(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  double *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator /", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd___SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.-@
+
+  call-seq:
+    -@ -> MatrixD
+
+Substraction operator.
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___neg__(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss_((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.+
+
+  call-seq:
+    +(matrix) -> MatrixD
+    +(matrix) -> MatrixD
+    +(scalar) -> MatrixD
+
+Add operator.
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___add____SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
   void *argp1 = 0 ;
@@ -11237,19 +11498,19 @@ _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_1(int argc, VALUE *argv, VALUE se
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator +<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__entrywise_product_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
   } catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
@@ -11261,7 +11522,7 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_entrywise_product__SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___add____SWIG_2(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
   void *argp1 = 0 ;
@@ -11276,19 +11537,19 @@ _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_2(int argc, VALUE *argv, VALUE se
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator +<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__entrywise_product_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
   } catch(std::invalid_argument &_e) {
     SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
@@ -11299,7 +11560,45 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_entrywise_product(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___add____SWIG_3(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  double *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator +", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator +", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sa___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___add__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[3];
   int ii;
@@ -11320,7 +11619,7 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_entrywise_product(int nargs, VALUE *args
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_1(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___add____SWIG_1(nargs, args, self);
       }
     }
   }
@@ -11334,33 +11633,820 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_entrywise_product(int nargs, VALUE *args
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_2(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___add____SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___add____SWIG_3(nargs, args, self);
       }
     }
   }
-  
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "__add__", 
+    "    Matrix< double,Array2D_Dense< double > > __add__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __add__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __add__(double const &scalar)\n");
+  
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.-
+
+  call-seq:
+    -(matrix) -> MatrixD
+    -(matrix) -> MatrixD
+    -(scalar) -> MatrixD
+
+Substraction operator.
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___sub____SWIG_1(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator -<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___sub____SWIG_2(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator -<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___sub____SWIG_3(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  double *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator -", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","operator -", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Ss___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___sub__(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___sub____SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___sub____SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___sub____SWIG_3(nargs, args, self);
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "__sub__", 
+    "    Matrix< double,Array2D_Dense< double > > __sub__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __sub__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __sub__(double const &scalar)\n");
+  
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.entrywise_product
+
+  call-seq:
+    entrywise_product(Matrix_FrozenD matrix) -> MatrixD
+    entrywise_product(Matrix_FrozenD_f matrix) -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_entrywise_product__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__entrywise_product_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_1((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_entrywise_product__SWIG_2(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","entrywise_product<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__entrywise_product_Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_entrywise_product(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_1(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f_entrywise_product__SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "entrywise_product", 
+    "    Matrix< double,Array2D_Dense< double > > entrywise_product(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > entrywise_product(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
+  
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.*
+
+  call-seq:
+    *(double const & scalar) -> MatrixD
+    *(Matrix_FrozenD matrix) -> MatrixD
+    *(Matrix_FrozenD_f matrix) -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___mul____SWIG_2(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f___mul____SWIG_3(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+  }
+  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___mul__(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___mul____SWIG_2(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___mul____SWIG_3(nargs, args, self);
+      }
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_double(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f___mul____SWIG_0(nargs, args, self);
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "__mul__", 
+    "    Matrix< double,Array2D_Dense< double > > __mul__(double const &scalar)\n"
+    "    Matrix< double,Array2D_Dense< double > > __mul__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __mul__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
+  
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.first_minor
+
+  call-seq:
+    first_minor(unsigned int const & row, unsigned int const & column) -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_first_minor(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  unsigned int *arg2 = 0 ;
+  unsigned int *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  unsigned int temp3 ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","first_minor", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","first_minor", 2, argv[0] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","first_minor", 3, argv[1] ));
+  } 
+  temp3 = static_cast< unsigned int >(val3);
+  arg3 = &temp3;
+  raise_if_lt_zero_after_asval(*arg2);
+  raise_if_lt_zero_after_asval(*arg3);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__first_minor((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.adjugate
+
+  call-seq:
+    adjugate -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_adjugate(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","adjugate", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__adjugate((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.lup
+
+  call-seq:
+    lup
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_lup(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Matrix< double,Array2D_Dense< double > > temp2 ;
+  Matrix< double,Array2D_Dense< double > > temp3 ;
+  Matrix< double,Array2D_Dense< double > > temp4 ;
+  VALUE vresult = Qnil;
+  
+  
+  arg2 = &temp2;
+  
+  
+  arg3 = &temp3;
+  
+  
+  arg4 = &temp4;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","lup", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__lup((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3,*arg4);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = rb_ary_new();
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg4)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.ud
+
+  call-seq:
+    ud
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_ud(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Matrix< double,Array2D_Dense< double > > temp2 ;
+  Matrix< double,Array2D_Dense< double > > temp3 ;
+  VALUE vresult = Qnil;
+  
+  
+  arg2 = &temp2;
+  
+  
+  arg3 = &temp3;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","ud", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__ud((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = rb_ary_new();
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.qr
+
+  call-seq:
+    qr
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_qr(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
+  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Matrix< double,Array2D_Dense< double > > temp2 ;
+  Matrix< double,Array2D_Dense< double > > temp3 ;
+  VALUE vresult = Qnil;
+  
+  
+  arg2 = &temp2;
+  
+  
+  arg3 = &temp3;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","qr", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__qr((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3);
+  vresult = rb_ary_new();
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  {
+    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  }
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.inverse
+
+  call-seq:
+    inverse -> MatrixD
+
+An instance method.
+
+*/
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_inverse(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","inverse", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__inverse((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "entrywise_product", 
-    "    Matrix< double,Array2D_Dense< double > > entrywise_product(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > entrywise_product(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
-  
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f./
 
   call-seq:
-    *(double const & scalar) -> MatrixD
-    *(Matrix_FrozenD matrix) -> MatrixD
-    *(Matrix_FrozenD_f matrix) -> MatrixD
+    /(double const & scalar) -> MatrixD
+    /(Matrix_FrozenD matrix) -> MatrixD
+    /(Matrix_FrozenD_f matrix) -> MatrixD
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___mul____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___div____SWIG_2(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
   void *argp1 = 0 ;
@@ -11375,21 +12461,23 @@ _wrap_Matrix_FrozenD_f___mul____SWIG_2(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator *<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
   vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
@@ -11399,7 +12487,7 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___mul____SWIG_3(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f___div____SWIG_3(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
   void *argp1 = 0 ;
@@ -11414,21 +12502,23 @@ _wrap_Matrix_FrozenD_f___mul____SWIG_3(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
+    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
   }
   if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator *<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
   }
   arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sm__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  } catch(std::invalid_argument &_e) {
-    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
+  } catch(std::logic_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+  } catch(std::runtime_error &_e) {
+    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
   }
   vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
@@ -11437,7 +12527,7 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___mul__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___div__(int nargs, VALUE *args, VALUE self) {
   int argc;
   VALUE argv[3];
   int ii;
@@ -11458,7 +12548,7 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___mul__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___mul____SWIG_2(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___div____SWIG_2(nargs, args, self);
       }
     }
   }
@@ -11472,7 +12562,7 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___mul__(int nargs, VALUE *args, VALUE se
       int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
       _v = SWIG_CheckState(res);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___mul____SWIG_3(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___div____SWIG_3(nargs, args, self);
       }
     }
   }
@@ -11487,70 +12577,48 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___mul__(int nargs, VALUE *args, VALUE se
         _v = SWIG_CheckState(res);
       }
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___mul____SWIG_0(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f___div____SWIG_0(nargs, args, self);
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "__mul__", 
-    "    Matrix< double,Array2D_Dense< double > > __mul__(double const &scalar)\n"
-    "    Matrix< double,Array2D_Dense< double > > __mul__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __mul__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
+  Ruby_Format_OverloadedError( argc, 3, "__div__", 
+    "    Matrix< double,Array2D_Dense< double > > __div__(double const &scalar)\n"
+    "    Matrix< double,Array2D_Dense< double > > __div__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
+    "    Matrix< double,Array2D_Dense< double > > __div__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
   
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.first_minor
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.debug
 
   call-seq:
-    first_minor(unsigned int const & row, unsigned int const & column) -> MatrixD
+    debug -> std::string
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_first_minor(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_debug(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  unsigned int *arg2 = 0 ;
-  unsigned int *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int temp2 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
-  unsigned int temp3 ;
-  unsigned int val3 ;
-  int ecode3 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  std::string result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","first_minor", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","debug", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[0], &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","first_minor", 2, argv[0] ));
-  } 
-  temp2 = static_cast< unsigned int >(val2);
-  arg2 = &temp2;
-  ecode3 = SWIG_AsVal_unsigned_SS_int(argv[1], &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "unsigned int","first_minor", 3, argv[1] ));
-  } 
-  temp3 = static_cast< unsigned int >(val3);
-  arg3 = &temp3;
-  raise_if_lt_zero_after_asval(*arg2);
-  raise_if_lt_zero_after_asval(*arg3);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__first_minor((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(unsigned int const &)*arg2,(unsigned int const &)*arg3);
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__debug((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  vresult = SWIG_From_std_string(static_cast< std::string >(result));
   return vresult;
 fail:
   return Qnil;
@@ -11558,215 +12626,331 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.adjugate
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.each
 
   call-seq:
-    adjugate -> MatrixD
-
-An instance method.
+    each(each_which=MatrixUtil::EACH_ALL) -> Matrix_FrozenD_f
+    each -> Matrix_FrozenD_f
 
+Iterate thru each element in the Matrix_FrozenD_f.  A block must be provided.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_adjugate(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_each__SWIG_0(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
+  MatrixUtil::each_which_t arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *result = 0 ;
+  VALUE vresult = Qnil;
+  
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    arg2 = matrix_each((const double *)0);
+  }
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  }
+  res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","each", 1, self )); 
+  }
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  {
+    arg3 = MatrixUtil::sym2each_which(argv[0]);
+    if(arg3 == MatrixUtil::EACH_UNKNOWN){
+      SWIG_exception(SWIG_ValueError,
+        std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
+    }
+  }
+  try {
+    result = (Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *) &Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  }
+  vresult = self;
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE
+_wrap_Matrix_FrozenD_f_each__SWIG_1(int argc, VALUE *argv, VALUE self) {
+  Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *result = 0 ;
   VALUE vresult = Qnil;
   
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    arg2 = matrix_each((const double *)0);
+  }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","adjugate", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","each", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__adjugate((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  try {
+    result = (Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *) &Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  }
+  vresult = self;
   return vresult;
 fail:
   return Qnil;
 }
 
 
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_each(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
+  }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_Matrix_FrozenD_f_each__SWIG_1(nargs, args, self);
+    }
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
+      }
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f_each__SWIG_0(nargs, args, self);
+      }
+    }
+  }
+  
+fail:
+  Ruby_Format_OverloadedError( argc, 3, "each", 
+    "    Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const each(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &), MatrixUtil::each_which_t const each_which)\n"
+    "    Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const & each(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &))\n");
+  
+  return Qnil;
+}
+
+
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.lup
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.map
 
   call-seq:
-    lup
+    map(MatrixUtil::each_which_t const each_which=MatrixUtil::EACH_ALL) -> MatrixD
+    map -> MatrixD
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_lup(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_map__SWIG_0(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg4 = 0 ;
+  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
+  MatrixUtil::each_which_t arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix< double,Array2D_Dense< double > > temp2 ;
-  Matrix< double,Array2D_Dense< double > > temp3 ;
-  Matrix< double,Array2D_Dense< double > > temp4 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  
-  arg2 = &temp2;
-  
-  
-  arg3 = &temp3;
-  
-  
-  arg4 = &temp4;
-  
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    arg2 = matrix_each((const double *)0);
+  }
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","lup", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  try {
-    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__lup((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3,*arg4);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  }
-  vresult = rb_ary_new();
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
-  }
   {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+    arg3 = MatrixUtil::sym2each_which(argv[0]);
+    if(arg3 == MatrixUtil::EACH_UNKNOWN){
+      SWIG_exception(SWIG_ValueError,
+        std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
+    }
   }
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg4)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.ud
-
-  call-seq:
-    ud
-
-An instance method.
-
-*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_ud(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_map__SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
+  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix< double,Array2D_Dense< double > > temp2 ;
-  Matrix< double,Array2D_Dense< double > > temp3 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  
-  arg2 = &temp2;
-  
-  
-  arg3 = &temp3;
-  
+  {
+    if(!rb_block_given_p()){
+      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
+    }
+    arg2 = matrix_each((const double *)0);
+  }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","ud", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   try {
-    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__ud((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = rb_ary_new();
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_map(int nargs, VALUE *args, VALUE self) {
+  int argc;
+  VALUE argv[3];
+  int ii;
+  
+  argc = nargs + 1;
+  argv[0] = self;
+  if (argc > 3) SWIG_fail;
+  for (ii = 1; (ii < argc); ++ii) {
+    argv[ii] = args[ii-1];
   }
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_Matrix_FrozenD_f_map__SWIG_1(nargs, args, self);
+    }
   }
-  return vresult;
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
+      }
+      if (_v) {
+        return _wrap_Matrix_FrozenD_f_map__SWIG_0(nargs, args, self);
+      }
+    }
+  }
+  
 fail:
+  Ruby_Format_OverloadedError( argc, 3, "map", 
+    "    Matrix< double,Array2D_Dense< double > > map(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &), MatrixUtil::each_which_t const each_which)\n"
+    "    Matrix< double,Array2D_Dense< double > > map(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &))\n");
+  
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.qr
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.index
 
   call-seq:
-    qr
+    index(MatrixUtil::each_which_t const each_which=MatrixUtil::EACH_ALL) -> VALUE
+    index -> VALUE
+    index(VALUE value, VALUE idx_selector=Qnil) -> VALUE
+    index(VALUE value) -> VALUE
 
 An instance method.
 
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_qr(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_index__SWIG_0(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg2 = 0 ;
-  Matrix< double,Array2D_Dense< double > > *arg3 = 0 ;
+  MatrixUtil::each_which_t arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix< double,Array2D_Dense< double > > temp2 ;
-  Matrix< double,Array2D_Dense< double > > temp3 ;
+  VALUE result;
   VALUE vresult = Qnil;
   
-  
-  arg2 = &temp2;
-  
-  
-  arg3 = &temp3;
-  
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","qr", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__qr((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,*arg2,*arg3);
-  vresult = rb_ary_new();
   {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg2)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+    arg2 = MatrixUtil::sym2each_which(argv[0]);
+    if(arg2 == MatrixUtil::EACH_UNKNOWN){
+      SWIG_exception(SWIG_ValueError,
+        std::string("Unknown enumerate direction: ").append(inspect_str(arg2)).c_str());
+    }
   }
-  {
-    vresult = SWIG_Ruby_AppendOutput(vresult, SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(*arg3)), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN));
+  try {
+    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
   }
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.inverse
-
-  call-seq:
-    inverse -> MatrixD
-
-An instance method.
-
-*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_inverse(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_index__SWIG_1(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -11774,69 +12958,53 @@ _wrap_Matrix_FrozenD_f_inverse(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","inverse", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__inverse((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
 }
 
 
-/*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f./
-
-  call-seq:
-    /(double const & scalar) -> MatrixD
-    /(Matrix_FrozenD matrix) -> MatrixD
-    /(Matrix_FrozenD_f matrix) -> MatrixD
-
-An instance method.
-
-*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___div____SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_index__SWIG_2(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > *arg2 = 0 ;
+  VALUE arg2 = (VALUE) 0 ;
+  VALUE arg3 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &","operator /<(T,Array2D_Dense<(T)>,MatViewBase)>", 2, argv[0])); 
+  arg2 = argv[0];
+  arg3 = argv[1];
+  if(MatrixUtil::sym2each_which(arg3) == MatrixUtil::EACH_UNKNOWN){
+    SWIG_exception(SWIG_ValueError,
+      std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
   }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > * >(argp2);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatViewBase_Sg___SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &)*arg2);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -11844,14 +13012,12 @@ fail:
 
 
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f___div____SWIG_3(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_index__SWIG_3(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *arg2 = 0 ;
+  VALUE arg2 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 1) || (argc > 1)) {
@@ -11859,53 +13025,54 @@ _wrap_Matrix_FrozenD_f___div____SWIG_3(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 1, self )); 
-  }
-  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  res2 = SWIG_ConvertPtr(argv[0], &argp2, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t,  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0] )); 
-  }
-  if (!argp2) {
-    SWIG_exception_fail(SWIG_ValueError, Ruby_Format_TypeError("invalid null reference ", "Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &","operator /<(T,Array2D_Dense<(T)>,MatView_f)>", 2, argv[0])); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
   }
-  arg2 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > * >(argp2);
+  arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
+  arg2 = argv[0];
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__operator_Sd__Sl_T_Sc_Array2D_Dense_Sl_T_Sg__Sc_MatView_f_Sg___SWIG_3((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &)*arg2);
-  } catch(std::logic_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
-  } catch(std::runtime_error &_e) {
-    SWIG_exception_fail(SWIG_RuntimeError, (&_e)->what());
+    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
   }
-  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___div__(int nargs, VALUE *args, VALUE self) {
+SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_index(int nargs, VALUE *args, VALUE self) {
   int argc;
-  VALUE argv[3];
+  VALUE argv[4];
   int ii;
   
   argc = nargs + 1;
   argv[0] = self;
-  if (argc > 3) SWIG_fail;
+  if (argc > 4) SWIG_fail;
   for (ii = 1; (ii < argc); ++ii) {
     argv[ii] = args[ii-1];
   }
+  if (argc == 1) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      return _wrap_Matrix_FrozenD_f_index__SWIG_1(nargs, args, self);
+    }
+  }
   if (argc == 2) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
+      {
+        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
+      }
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___div____SWIG_2(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f_index__SWIG_0(nargs, args, self);
       }
     }
   }
@@ -11915,55 +13082,53 @@ SWIGINTERN VALUE _wrap_Matrix_FrozenD_f___div__(int nargs, VALUE *args, VALUE se
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      void *vptr = 0;
-      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, SWIG_POINTER_NO_NULL);
-      _v = SWIG_CheckState(res);
+      _v = (argv[1] != 0);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___div____SWIG_3(nargs, args, self);
+        return _wrap_Matrix_FrozenD_f_index__SWIG_3(nargs, args, self);
       }
     }
   }
-  if (argc == 2) {
+  if (argc == 3) {
     int _v;
     void *vptr = 0;
     int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
     _v = SWIG_CheckState(res);
     if (_v) {
-      {
-        int res = SWIG_AsVal_double(argv[1], NULL);
-        _v = SWIG_CheckState(res);
-      }
+      _v = (argv[1] != 0);
       if (_v) {
-        return _wrap_Matrix_FrozenD_f___div____SWIG_0(nargs, args, self);
+        _v = (argv[2] != 0);
+        if (_v) {
+          return _wrap_Matrix_FrozenD_f_index__SWIG_2(nargs, args, self);
+        }
       }
     }
   }
   
 fail:
-  Ruby_Format_OverloadedError( argc, 3, "__div__", 
-    "    Matrix< double,Array2D_Dense< double > > __div__(double const &scalar)\n"
-    "    Matrix< double,Array2D_Dense< double > > __div__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewBase< > > const &matrix)\n"
-    "    Matrix< double,Array2D_Dense< double > > __div__(Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const &matrix)\n");
+  Ruby_Format_OverloadedError( argc, 4, "index", 
+    "    VALUE index(MatrixUtil::each_which_t const each_which)\n"
+    "    VALUE index()\n"
+    "    VALUE index(VALUE value, VALUE idx_selector)\n"
+    "    VALUE index(VALUE value)\n");
   
   return Qnil;
 }
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.debug
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.to_a
 
   call-seq:
-    debug -> std::string
-
-An instance method.
+    to_a -> VALUE
 
+Convert Matrix_FrozenD_f to an Array.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_debug(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_to_a(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  std::string result;
+  VALUE result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -11971,11 +13136,11 @@ _wrap_Matrix_FrozenD_f_debug(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","debug", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","to_a", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__debug((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  vresult = SWIG_From_std_string(static_cast< std::string >(result));
+  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__to_a((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
@@ -11983,86 +13148,70 @@ fail:
 
 
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.each
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.to_binary
 
   call-seq:
-    each(each_which=MatrixUtil::EACH_ALL) -> Matrix_FrozenD_f
-    each -> Matrix_FrozenD_f
+    to_binary -> VALUE
 
-Iterate thru each element in the Matrix_FrozenD_f.  A block must be provided.
+Convert Matrix_FrozenD_f to a row-major packed native double String.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_each__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_to_binary(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
-  MatrixUtil::each_which_t arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *result = 0 ;
+  VALUE result;
   VALUE vresult = Qnil;
   
-  {
-    if(!rb_block_given_p()){
-      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
-    }
-    arg2 = matrix_each((const double *)0);
-  }
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","each", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","to_binary", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  {
-    arg3 = MatrixUtil::sym2each_which(argv[0]);
-    if(arg3 == MatrixUtil::EACH_UNKNOWN){
-      SWIG_exception(SWIG_ValueError,
-        std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
-    }
-  }
-  try {
-    result = (Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *) &Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
-  } catch(native_exception &_e) {
-    (&_e)->regenerate();
-    SWIG_fail;
-  }
-  vresult = self;
+  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__to_binary((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+  vresult = result;
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.each_row
+
+  call-seq:
+    each_row -> Matrix_FrozenD_f
+
+Yield each row as a packed native double String ("d*") with its index, once per row.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_each__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_each_row(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *result = 0 ;
   VALUE vresult = Qnil;
   
-  {
-    if(!rb_block_given_p()){
-      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
-    }
-    arg2 = matrix_each((const double *)0);
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
   }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","each", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","each_row", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   try {
-    result = (Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > *) &Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+    Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__each_row((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
   vresult = self;
   return vresult;
@@ -12071,93 +13220,35 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_each(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[3];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 3) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_Matrix_FrozenD_f_each__SWIG_1(nargs, args, self);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
-      }
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_each__SWIG_0(nargs, args, self);
-      }
-    }
-  }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 3, "each", 
-    "    Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const each(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &), MatrixUtil::each_which_t const each_which)\n"
-    "    Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const & each(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &))\n");
-  
-  return Qnil;
-}
-
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.map
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.map_rows
 
   call-seq:
-    map(MatrixUtil::each_which_t const each_which=MatrixUtil::EACH_ALL) -> MatrixD
-    map -> MatrixD
-
-An instance method.
+    map_rows -> MatrixD
 
+Build a new matrix from rows returned as Array or packed String, once per row.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_map__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_map_rows(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
-  MatrixUtil::each_which_t arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  {
-    if(!rb_block_given_p()){
-      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
-    }
-    arg2 = matrix_each((const double *)0);
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
   }
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map_rows", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  {
-    arg3 = MatrixUtil::sym2each_which(argv[0]);
-    if(arg3 == MatrixUtil::EACH_UNKNOWN){
-      SWIG_exception(SWIG_ValueError,
-        std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
-    }
-  }
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map_rows((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
@@ -12171,31 +13262,36 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.map_packed
+
+  call-seq:
+    map_packed -> MatrixD
+
+Yield a row-major packed native double String with rows and columns once,
+and build a new matrix from the returned packed String.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_map__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_map_packed(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  void (*arg2)(double const &,double *,unsigned int const &,unsigned int const &) = (void (*)(double const &,double *,unsigned int const &,unsigned int const &)) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  {
-    if(!rb_block_given_p()){
-      return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
-    }
-    arg2 = matrix_each((const double *)0);
+  if(!rb_block_given_p()){
+    return rb_enumeratorize(self, ID2SYM(rb_frame_callee()), argc, argv);
   }
   if ((argc < 0) || (argc > 0)) {
     rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","map_packed", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   try {
-    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__map_packed((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
@@ -12209,105 +13305,59 @@ fail:
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_map(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[3];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 3) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_Matrix_FrozenD_f_map__SWIG_1(nargs, args, self);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
-      }
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_map__SWIG_0(nargs, args, self);
-      }
-    }
-  }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 3, "map", 
-    "    Matrix< double,Array2D_Dense< double > > map(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &), MatrixUtil::each_which_t const each_which)\n"
-    "    Matrix< double,Array2D_Dense< double > > map(void (*each_func)(double const &,double *,unsigned int const &,unsigned int const &))\n");
-  
-  return Qnil;
-}
-
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.index
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.abs
 
   call-seq:
-    index(MatrixUtil::each_which_t const each_which=MatrixUtil::EACH_ALL) -> VALUE
-    index -> VALUE
-    index(VALUE value, VALUE idx_selector=Qnil) -> VALUE
-    index(VALUE value) -> VALUE
-
-An instance method.
+    abs -> MatrixD
 
+Elementwise absolute value without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_index__SWIG_0(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_abs(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  MatrixUtil::each_which_t arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","abs", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  {
-    arg2 = MatrixUtil::sym2each_which(argv[0]);
-    if(arg2 == MatrixUtil::EACH_UNKNOWN){
-      SWIG_exception(SWIG_ValueError,
-        std::string("Unknown enumerate direction: ").append(inspect_str(arg2)).c_str());
-    }
-  }
   try {
-    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__abs((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = result;
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.sqrt
+
+  call-seq:
+    sqrt -> MatrixD
+
+Elementwise square root without Ruby block.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_index__SWIG_1(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_sqrt(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
   if ((argc < 0) || (argc > 0)) {
@@ -12315,189 +13365,165 @@ _wrap_Matrix_FrozenD_f_index__SWIG_1(int argc, VALUE *argv, VALUE self) {
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","sqrt", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
   try {
-    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_0((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__sqrt((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = result;
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.exp
+
+  call-seq:
+    exp -> MatrixD
+
+Elementwise exponential without Ruby block.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_index__SWIG_2(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_exp(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  VALUE arg2 = (VALUE) 0 ;
-  VALUE arg3 = (VALUE) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 2) || (argc > 2)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
+  if ((argc < 0) || (argc > 0)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","exp", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  arg2 = argv[0];
-  arg3 = argv[1];
-  if(MatrixUtil::sym2each_which(arg3) == MatrixUtil::EACH_UNKNOWN){
-    SWIG_exception(SWIG_ValueError,
-      std::string("Unknown enumerate direction: ").append(inspect_str(arg3)).c_str());
-  }
   try {
-    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2,arg3);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__exp((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = result;
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.clamp
+
+  call-seq:
+    clamp(double const & lower, double const & upper) -> MatrixD
+
+Elementwise clamp into [lower, upper] without Ruby block.
+*/
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_index__SWIG_3(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_clamp(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
-  VALUE arg2 = (VALUE) 0 ;
+  double *arg2 = 0 ;
+  double *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  double temp3 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 1) || (argc > 1)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
+  if ((argc < 2) || (argc > 2)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 2)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","index", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","clamp", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  arg2 = argv[0];
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","clamp", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  ecode3 = SWIG_AsVal_double(argv[1], &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), Ruby_Format_TypeError( "", "double","clamp", 3, argv[1] ));
+  } 
+  temp3 = static_cast< double >(val3);
+  arg3 = &temp3;
   try {
-    result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__index__SWIG_2((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,arg2);
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__clamp((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2,(double const &)*arg3);
   } catch(native_exception &_e) {
     (&_e)->regenerate();
     SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
   }
-  vresult = result;
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
 }
 
 
-SWIGINTERN VALUE _wrap_Matrix_FrozenD_f_index(int nargs, VALUE *args, VALUE self) {
-  int argc;
-  VALUE argv[4];
-  int ii;
-  
-  argc = nargs + 1;
-  argv[0] = self;
-  if (argc > 4) SWIG_fail;
-  for (ii = 1; (ii < argc); ++ii) {
-    argv[ii] = args[ii-1];
-  }
-  if (argc == 1) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      return _wrap_Matrix_FrozenD_f_index__SWIG_1(nargs, args, self);
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      {
-        _v = (MatrixUtil::sym2each_which(argv[1]) != MatrixUtil::EACH_UNKNOWN);
-      }
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_index__SWIG_0(nargs, args, self);
-      }
-    }
-  }
-  if (argc == 2) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      _v = (argv[1] != 0);
-      if (_v) {
-        return _wrap_Matrix_FrozenD_f_index__SWIG_3(nargs, args, self);
-      }
-    }
-  }
-  if (argc == 3) {
-    int _v;
-    void *vptr = 0;
-    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0);
-    _v = SWIG_CheckState(res);
-    if (_v) {
-      _v = (argv[1] != 0);
-      if (_v) {
-        _v = (argv[2] != 0);
-        if (_v) {
-          return _wrap_Matrix_FrozenD_f_index__SWIG_2(nargs, args, self);
-        }
-      }
-    }
-  }
-  
-fail:
-  Ruby_Format_OverloadedError( argc, 4, "index", 
-    "    VALUE index(MatrixUtil::each_which_t const each_which)\n"
-    "    VALUE index()\n"
-    "    VALUE index(VALUE value, VALUE idx_selector)\n"
-    "    VALUE index(VALUE value)\n");
-  
-  return Qnil;
-}
-
-
 /*
-  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.to_a
+  Document-method: GPS_PVT::SylphideMath::Matrix_FrozenD_f.scale
 
   call-seq:
-    to_a -> VALUE
+    scale(double const & k) -> MatrixD
 
-Convert Matrix_FrozenD_f to an Array.
+Elementwise multiplication by k without Ruby block.
 */
 SWIGINTERN VALUE
-_wrap_Matrix_FrozenD_f_to_a(int argc, VALUE *argv, VALUE self) {
+_wrap_Matrix_FrozenD_f_scale(int argc, VALUE *argv, VALUE self) {
   Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *arg1 = (Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > *) 0 ;
+  double *arg2 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  VALUE result;
+  double temp2 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
   VALUE vresult = Qnil;
   
-  if ((argc < 0) || (argc > 0)) {
-    rb_raise(rb_eArgError, "wrong # of arguments(%d for 0)",argc); SWIG_fail;
+  if ((argc < 1) || (argc > 1)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 1)",argc); SWIG_fail;
   }
   res1 = SWIG_ConvertPtr(self, &argp1,SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","to_a", 1, self )); 
+    SWIG_exception_fail(SWIG_ArgError(res1), Ruby_Format_TypeError( "", "Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > const *","scale", 1, self )); 
   }
   arg1 = reinterpret_cast< Matrix_Frozen< double,Array2D_Dense< double >,MatView_f > * >(argp1);
-  result = (VALUE)Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__to_a((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1);
-  vresult = result;
+  ecode2 = SWIG_AsVal_double(argv[0], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "double","scale", 2, argv[0] ));
+  } 
+  temp2 = static_cast< double >(val2);
+  arg2 = &temp2;
+  try {
+    result = Matrix_Frozen_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sc_MatView_f_Sg__scale((Matrix_Frozen< double,Array2D_Dense< double >,MatrixViewFilter< MatrixViewBase< > > > const *)arg1,(double const &)*arg2);
+  } catch(native_exception &_e) {
+    (&_e)->regenerate();
+    SWIG_fail;
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
   return vresult;
 fail:
   return Qnil;
@@ -13465,6 +14491,59 @@ fail:
 }
 
 
+/*
+  Document-method: GPS_PVT::SylphideMath::MatrixD.from_binary
+
+  call-seq:
+    from_binary(unsigned int const & rows, unsigned int const & columns, VALUE packed) -> MatrixD
+
+A class method.
+
+*/
+SWIGINTERN VALUE
+_wrap_MatrixD_from_binary(int argc, VALUE *argv, VALUE self) {
+  unsigned int *arg1 = 0 ;
+  unsigned int *arg2 = 0 ;
+  VALUE arg3 = (VALUE) 0 ;
+  unsigned int temp1 ;
+  unsigned int val1 ;
+  int ecode1 = 0 ;
+  unsigned int temp2 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  SwigValueWrapper< Matrix< double,Array2D_Dense< double > > > result;
+  VALUE vresult = Qnil;
+  
+  if ((argc < 3) || (argc > 3)) {
+    rb_raise(rb_eArgError, "wrong # of arguments(%d for 3)",argc); SWIG_fail;
+  }
+  ecode1 = SWIG_AsVal_unsigned_SS_int(argv[0], &val1);
+  if (!SWIG_IsOK(ecode1)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode1), Ruby_Format_TypeError( "", "unsigned int","Matrix_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sg__from_binary", 1, argv[0] ));
+  } 
+  temp1 = static_cast< unsigned int >(val1);
+  arg1 = &temp1;
+  ecode2 = SWIG_AsVal_unsigned_SS_int(argv[1], &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), Ruby_Format_TypeError( "", "unsigned int","Matrix_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sg__from_binary", 2, argv[1] ));
+  } 
+  temp2 = static_cast< unsigned int >(val2);
+  arg2 = &temp2;
+  arg3 = argv[2];
+  raise_if_lt_zero_after_asval(*arg1);
+  raise_if_lt_zero_after_asval(*arg2);
+  try {
+    result = Matrix_Sl_double_Sc_Array2D_Dense_Sl_double_Sg__Sg__from_binary((unsigned int const &)*arg1,(unsigned int const &)*arg2,arg3);
+  } catch(std::invalid_argument &_e) {
+    SWIG_exception_fail(SWIG_ValueError, (&_e)->what());
+  }
+  vresult = SWIG_NewPointerObj((new Matrix< double,Array2D_Dense< double > >(static_cast< const Matrix< double,Array2D_Dense< double > >& >(result))), SWIGTYPE_p_MatrixT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t, SWIG_POINTER_OWN |  0 );
+  return vresult;
+fail:
+  return Qnil;
+}
+
+
 /*
   Document-method: GPS_PVT::SylphideMath::MatrixD.swap_rows
 
@@ -22633,7 +23712,20 @@ SWIGEXPORT void Init_SylphideMath(void) {
   rb_define_method(SwigClassMatrix_FrozenD.klass, "index", VALUEFUNC(_wrap_Matrix_FrozenD_index), -1);
   rb_define_alias(SwigClassMatrix_FrozenD.klass, "find_index", "index");
   rb_define_method(SwigClassMatrix_FrozenD.klass, "to_a", VALUEFUNC(_wrap_Matrix_FrozenD_to_a), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "to_binary", VALUEFUNC(_wrap_Matrix_FrozenD_to_binary), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "to_str", VALUEFUNC(_wrap_Matrix_FrozenD_to_binary), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "each_row", VALUEFUNC(_wrap_Matrix_FrozenD_each_row), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "map_rows", VALUEFUNC(_wrap_Matrix_FrozenD_map_rows), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "map_packed", VALUEFUNC(_wrap_Matrix_FrozenD_map_packed), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "abs", VALUEFUNC(_wrap_Matrix_FrozenD_abs), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "sqrt", VALUEFUNC(_wrap_Matrix_FrozenD_sqrt), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "exp", VALUEFUNC(_wrap_Matrix_FrozenD_exp), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "clamp", VALUEFUNC(_wrap_Matrix_FrozenD_clamp), -1);
+  rb_define_method(SwigClassMatrix_FrozenD.klass, "scale", VALUEFUNC(_wrap_Matrix_FrozenD_scale), -1);
   rb_define_method(SwigClassMatrix_FrozenD.klass, "to_shareable", VALUEFUNC(_wrap_Matrix_FrozenD_to_shareable), -1);
+#if RUBY_API_VERSION_CODE >= 30000
+  MatrixMemoryView<MatViewBase>::register_class(SwigClassMatrix_FrozenD.klass, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewBaseT_t_t);
+#endif
   rb_define_method(SwigClassMatrix_FrozenD.klass, "to_s", VALUEFUNC(_wrap_Matrix_FrozenD___str__), -1);
   rb_define_method(SwigClassMatrix_FrozenD.klass, "conjugate", VALUEFUNC(_wrap_Matrix_FrozenD_conjugate), -1);
   rb_define_alias(SwigClassMatrix_FrozenD.klass, "conj", "conjugate");
@@ -22710,7 +23802,20 @@ SWIGEXPORT void Init_SylphideMath(void) {
   rb_define_method(SwigClassMatrix_FrozenD_f.klass, "index", VALUEFUNC(_wrap_Matrix_FrozenD_f_index), -1);
   rb_define_alias(SwigClassMatrix_FrozenD_f.klass, "find_index", "index");
   rb_define_method(SwigClassMatrix_FrozenD_f.klass, "to_a", VALUEFUNC(_wrap_Matrix_FrozenD_f_to_a), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "to_binary", VALUEFUNC(_wrap_Matrix_FrozenD_f_to_binary), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "to_str", VALUEFUNC(_wrap_Matrix_FrozenD_f_to_binary), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "each_row", VALUEFUNC(_wrap_Matrix_FrozenD_f_each_row), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "map_rows", VALUEFUNC(_wrap_Matrix_FrozenD_f_map_rows), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "map_packed", VALUEFUNC(_wrap_Matrix_FrozenD_f_map_packed), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "abs", VALUEFUNC(_wrap_Matrix_FrozenD_f_abs), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "sqrt", VALUEFUNC(_wrap_Matrix_FrozenD_f_sqrt), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "exp", VALUEFUNC(_wrap_Matrix_FrozenD_f_exp), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "clamp", VALUEFUNC(_wrap_Matrix_FrozenD_f_clamp), -1);
+  rb_define_method(SwigClassMatrix_FrozenD_f.klass, "scale", VALUEFUNC(_wrap_Matrix_FrozenD_f_scale), -1);
   rb_define_method(SwigClassMatrix_FrozenD_f.klass, "to_shareable", VALUEFUNC(_wrap_Matrix_FrozenD_f_to_shareable), -1);
+#if RUBY_API_VERSION_CODE >= 30000
+  MatrixMemoryView<MatView_f>::register_class(SwigClassMatrix_FrozenD_f.klass, SWIGTYPE_p_Matrix_FrozenT_double_Array2D_DenseT_double_t_MatrixViewFilterT_MatrixViewBaseT_t_t_t);
+#endif
   rb_define_method(SwigClassMatrix_FrozenD_f.klass, "to_s", VALUEFUNC(_wrap_Matrix_FrozenD_f___str__), -1);
   rb_define_method(SwigClassMatrix_FrozenD_f.klass, "conjugate", VALUEFUNC(_wrap_Matrix_FrozenD_f_conjugate), -1);
   rb_define_alias(SwigClassMatrix_FrozenD_f.klass, "conj", "conjugate");
@@ -22732,6 +23837,7 @@ SWIGEXPORT void Init_SylphideMath(void) {
   rb_define_method(SwigClassMatrixD.klass, "[]=", VALUEFUNC(_wrap_MatrixD___setitem__), -1);
   rb_define_singleton_method(SwigClassMatrixD.klass, "scalar", VALUEFUNC(_wrap_MatrixD_scalar), -1);
   rb_define_singleton_method(SwigClassMatrixD.klass, "I", VALUEFUNC(_wrap_MatrixD_I), -1);
+  rb_define_singleton_method(SwigClassMatrixD.klass, "from_binary", VALUEFUNC(_wrap_MatrixD_from_binary), -1);
   rb_define_method(SwigClassMatrixD.klass, "swap_rows!", VALUEFUNC(_wrap_MatrixD_swap_rowsN___), -1);
   rb_define_method(SwigClassMatrixD.klass, "swap_columns!", VALUEFUNC(_wrap_MatrixD_swap_columnsN___), -1);
   rb_define_method(SwigClassMatrixD.klass, "replace!", VALUEFUNC(_wrap_MatrixD_replaceN___), -1);
@@ -291,6 +291,12 @@ class Receiver
       when :fault_exclusion
         @solver.options = {:skip_exclusion => !(output_options[:FDE] = v.to_b)}
         next true
+      when :tracking # seed each epoch with the previous solution
+        @solver.options = {:tracking => v.to_b}
+        next true
+      when :ekf # recursive estimation with Kalman filter
+        @solver.options = {:ekf => v.to_b}
+        next true
       when :use_signal
         {
           :GPS_L2C => proc{@solver.gps_options.exclude_L2C = false},
@@ -325,14 +331,22 @@ class Receiver
   end
 
   GPS::Measurement.class_eval{
-    add_orig = instance_method(:add)
-    define_method(:add){|prn, key, value|
-      add_orig.bind(self).call(prn, key.kind_of?(Symbol) ? GPS::Measurement.const_get(key) : key, value)
-    }
     key2sym = GPS::Measurement.constants.inject([]){|res, k|
       res[GPS::Measurement.const_get(k)] = k if /^L\d/ =~ k.to_s
       res
     }
+    sym2key = Hash[*(key2sym.collect.with_index{|k, i| k && [k, i]}.compact.flatten(1))]
+    to_key = proc{|k| k.kind_of?(Symbol) ? (sym2key[k] || GPS::Measurement.const_get(k)) : k}
+    add_orig = instance_method(:add)
+    define_method(:add){|prn, key, value|
+      add_orig.bind(self).call(prn, to_key.call(key), value)
+    }
+    add_packed_orig = instance_method(:add_packed)
+    define_method(:add_packed){|prns, keys, values|
+      # values are acceptable as packed String ("d*"), Array, or object having to_binary such as Numo::NArray
+      add_packed_orig.bind(self).call(prns,
+          keys.kind_of?(Array) ? keys.collect(&to_key) : to_key.call(keys), values)
+    }
     define_method(:to_a2){
       collect{|prn, k, v| [prn, key2sym[k] || k, v]}
     }
@@ -390,21 +404,17 @@ class Receiver
       [[:@azimuth, az], [:@elevation, el]].each{|k, values|
         self.instance_variable_set(k, Hash[*(sats.zip(values).flatten(1))])
       }
-      mat_S = self.S
       [:@slopeH, :@slopeV] \
-          .zip((self.fd ? self.slope_HV_enu(mat_S).to_a.transpose : [nil, nil])) \
+          .zip((self.fd ? self.slope_HV_enu.to_a.transpose : [nil, nil])) \
           .each{|k, values|
         self.instance_variable_set(k,
             Hash[*(values ? sats.zip(values).flatten(1) : [])])
       }
-      # If a design matrix G has columns larger than 4, 
-      # other states excluding position and time are estimated.
-      @other_state = self.position_solved? \
-          ? (mat_S * self.delta_r.partial(self.used_satellites, 1, 0, 0)).transpose.to_a[0][4..-1] \
-          : []
       instance_variable_get(target)
     }
-    [:azimuth, :elevation, :slopeH, :slopeV, :other_state].each{|k|
+    # other_state, i.e., (S * delta_r)[4..-1] when a design matrix G has columns larger than 4,
+    # is natively calculated without intermediate matrices.
+    [:azimuth, :elevation, :slopeH, :slopeV].each{|k|
       eval("define_method(:#{k}){@#{k} || self.post_solution(:@#{k})}")
     }
   }
@@ -492,6 +502,9 @@ class Receiver
     }
     
     t_meas = nil
+    rawx_keys = Hash::new{|h, sig_k| # [sigid, kind] => key or nil (unsupported signal)
+      h[sig_k] = (GPS::Measurement.const_get(sig_k.join('_').to_sym) rescue nil)
+    }
     ubx.each_packet.with_index(1){|packet, i|
       $stderr.print '.' if i % 1000 == 0
       ubx_kind[packet[2..3]] += 1
@@ -530,6 +543,7 @@ class Receiver
         }
         t_meas = GPS::Time::new(week, sec)
         meas = GPS::Measurement::new
+        prns, keys, values = [[], [], []]
         packet[6 + 11].times{|i|
           loader = proc{|offset, len, str, post|
             v = packet.slice(6 + offset + (i * 32), len)
@@ -575,10 +589,12 @@ class Receiver
             :SIGNAL_STRENGTH_dBHz => [42, 1, "C"],
             :LOCK_SEC => [40, 2, "v", proc{|v| 1E-3 * v}],
           }.each{|k, prop|
+            next unless key = rawx_keys[[sigid, k]] # unsupported signal
             next unless v = loader.call(*prop)
-            meas.add(svid, "#{sigid}_#{k}".to_sym, v) rescue nil # unsupported signal
+            prns << svid; keys << key; values << v
           }
         }
+        meas.add_packed(prns, keys, values)
         after_run.call(run(meas, t_meas), [meas, t_meas])
       when [0x02, 0x11] # RXM-SFRB
         sys, svid = gnss_serial.call(packet[6 + 1])
@@ -605,93 +621,52 @@ class Receiver
     $stderr.puts ", found packets are %s"%[ubx_kind.inspect]
   end
   
+  def open_txt(src, &b)
+    txt = Util::get_txt(src, :stream => true)
+    begin
+      b.call(txt)
+    ensure
+      txt.close if (!txt.kind_of?(String)) && txt.respond_to?(:close) && (!txt.closed? rescue true)
+    end
+  end
+  private :open_txt
+
   def parse_rinex_nav(src)
-    fname = Util::get_txt(src)
-    items = [
-      @solver.gps_space_node,
-      @solver.sbas_space_node,
-      @solver.glonass_space_node,
-    ].inject(0){|res, sn|
-      loaded_items = critical{sn.send(:read, fname)}
-      raise "Format error! (Not RINEX) #{src}" if loaded_items < 0
-      res + loaded_items
-    }
+    # GPS, QZSS, SBAS and GLONASS space nodes are filled in one pass
+    items = open_txt(src){|txt| critical{@solver.read_rinex_nav(txt)}}
+    raise "Format error! (Not RINEX) #{src}" if items < 0
     $stderr.puts "Read RINEX NAV file (%s): %d items."%[src, items]
   end
   
   def parse_rinex_obs(src, &b)
-    fname = Util::get_txt(src)
     after_run = b || proc{|pvt| puts pvt.to_s if pvt}
     $stderr.print "Reading RINEX observation file (%s)"%[src]
-    types = nil
-    glonass_freq = nil
+    glonass_freq = {} # frequency channels saved with ephemeris
     count = 0
-    GPS::RINEX_Observation::read(fname){|item|
-      $stderr.print '.' if (count += 1) % 1000 == 0
-      t_meas = item[:time]
-
-      types ||= Hash[*(item[:meas_types].collect{|sys, values|
-        [sys, values.collect.with_index{|type_, i|
-          sig_obs_type = [case type_[1..-1]
-            when /^1C?$/; :L1
-            when /^2[XL]$/; :L2CL
-            when /^2S$/; :L2CM
-            else; nil
-          end, {
-            'C' => :PSEUDORANGE,
-            'L' => :CARRIER_PHASE,
-            'D' => :DOPPLER,
-            'S' => :SIGNAL_STRENGTH_dBHz,
-          }[type_[0]]]
-          next nil unless sig_obs_type.all?
-          [i, sig_obs_type.join('_').to_sym, *sig_obs_type]
-        }.compact]
-      }.flatten(1))]
-
-      glonass_freq ||= proc{|spec|
-        # frequency channels described in observation file
-        next {} unless spec
-        Hash[*(spec.collect{|line|
-          line[4..-1].scan(/R(\d{2}).([\s+-]\d)./).collect{|prn, ch|
-            [prn.to_i, GPS::SpaceNode_GLONASS::L1_frequency(ch.to_i)]
-          }
-        }.flatten(2))]
-      }.call(item[:header]["GLONASS SLOT / FRQ #"])
-
-      meas = GPS::Measurement::new
-      item[:meas].each{|(sys, prn), v|
-        case sys
-        when 'G', ' '
-        when 'S'; prn += 100
-        when 'J'; prn += 192
-        when 'R'
+    # observation type mapping and GLONASS frequency channels described in header
+    # are resolved in GPS::RINEX_Observation::read_measurement
+    # and decompression (if required) is performed concurrently with reading
+    open_txt(src){|txt|
+      GPS::RINEX_Observation::read_measurement(txt){|meas, t_meas, clk_err, glonass_missing|
+        $stderr.print '.' if (count += 1) % 1000 == 0
+        (glonass_missing || []).each{|prn|
           freq = (glonass_freq[prn] ||= proc{|sn|
-            # frequency channels saved with ephemeris
             sn.update_all_ephemeris(t_meas)
-            next nil unless sn.ephemeris(prn).in_range?(t_meas)
-            sn.ephemeris(prn).frequency_L1
+            eph = sn.ephemeris(prn - 0x100)
+            next nil unless eph.in_range?(t_meas)
+            eph.frequency_L1
           }.call(@solver.glonass_space_node))
-          prn += 0x100
           meas.add(prn, :L1_FREQUENCY, freq) if freq
-        else; next
-        end
-        types[sys] = (types[' '] || []) unless types[sys]
-        types[sys].each{|i, type_, sig_type, obs_type|
-          next unless v[i]
-          meas.add(prn, type_, v[i][0])
-          meas.add(prn, "#{sig_type}_CARRIER_PHASE_AMBIGUITY_SCALE".to_sym, 0.5) \
-              if (obs_type == :CARRIER_PHASE) && (v[i][1] & 0x2 == 0x2)
         }
+        after_run.call(run(meas, t_meas), [meas, t_meas])
       }
-      after_run.call(run(meas, t_meas), [meas, t_meas])
     }
     $stderr.puts ", %d epochs."%[count] 
   end
   
   def attach_sp3(src)
-    fname = Util::get_txt(src)
     @sp3 ||= GPS::SP3::new
-    read_items = @sp3.read(fname)
+    read_items = open_txt(src){|txt| @sp3.read(txt)}
     raise "Format error! (Not SP3) #{src}" if read_items < 0
     $stderr.puts "Read SP3 file (%s): %d items."%[src, read_items]
     sats = @sp3.satellites
@@ -705,17 +680,15 @@ class Receiver
   end
   
   def attach_antex(src)
-    fname = Util::get_txt(src)
     raise "Specify SP3 before ANTEX application!" unless @sp3
-    applied_items = critical{@sp3.apply_antex(fname)}
+    applied_items = open_txt(src){|txt| critical{@sp3.apply_antex(txt)}}
     raise "Format error! (Not ANTEX) #{src}" unless applied_items >= 0
     $stderr.puts "SP3 correction with ANTEX file (%s): %d items have been processed."%[src, applied_items]
   end
   
   def attach_rinex_clk(src)
-    fname = Util::get_txt(src)
     @clk ||= GPS::RINEX_Clock::new
-    read_items = @clk.read(fname)
+    read_items = open_txt(src){|txt| @clk.read(txt)}
     raise "Format error! (Not RINEX clock) #{src}" if read_items < 0
     $stderr.puts "Read RINEX clock file (%s): %d items."%[src, read_items]
     sats = @clk.satellites
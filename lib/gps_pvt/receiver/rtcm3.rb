@@ -31,7 +31,7 @@ class Receiver
     run_proc = proc{
       meas_ = GPS::Measurement::new
       meas.sort.each{|k, values| # larger msg_num entries have higher priority
-        values.each{|prn_k_v| meas_.add(*prn_k_v)}
+        meas_.add_packed(*values.transpose)
       }
       pvt = nil
       after_run.call(pvt = run(meas_, t_meas), [meas_, ref_time = t_meas]) if t_meas
@@ -1,4 +1,5 @@
 require 'tempfile'
+require 'stringio'
 require 'uri'
 
 proc{
@@ -75,7 +76,11 @@ module Util
         raise "Unknown compression type: #{type} of #{src}"
       end
     end
-    def get_txt(fname_or_uri)
+    def get_txt(fname_or_uri, opts = {})
+      # opts[:in_memory]: return StringIO instead of writing Tempfile,
+      # which can be passed to readers of RINEX, SP3 and so on.
+      # opts[:stream]: in addition to :in_memory, return decompressing IO for compressed local file,
+      # whose content is pulled by the readers on demand. It should be closed after use.
       is_uri = fname_or_uri.kind_of?(URI)
       open(fname_or_uri){|src|
         compressed = proc{
@@ -98,12 +103,31 @@ module Util
           next src # Kernel.open(obj) redirects to obj.open if obj responds to :open
         end unless compressed
 
+        if opts[:stream] && compressed && src.kind_of?(File) then
+          next inflate(src.path, compressed)
+        end
+
+        read_all = proc{
+          next src.read unless compressed
+          io = inflate((case src
+              when File, Tempfile; src.path
+              else; src
+              end), compressed)
+          begin
+            io.read
+          ensure
+            io.close # GzipReader or pipe of uncompress
+          end
+        }
+
+        if opts[:in_memory] || opts[:stream] then
+          next src if (!compressed) && src.kind_of?(StringIO)
+          next StringIO::new(read_all.call)
+        end
+
         Tempfile::open(File::basename($0, '.*')){|dst|
           dst.binmode
-          dst.write((compressed ? inflate((case src
-              when File, TempFile; src.path
-              else; src
-              end), compressed) : src).read)
+          dst.write(read_all.call)
           dst.rewind
           dst.path
         }
@@ -667,6 +667,63 @@ RSpec::describe GPS_PVT::SylphideMath::MatrixD do
       }
     end
   end
+
+  describe 'packed binary' do
+    let(:compare_with){ params[:rc][0].times.map{params[:rc][1].times.map{gen_elm.call} } }
+    let(:mat){mat_type::new(compare_with)}
+    it 'is exported with to_binary' do
+      packed = mat.to_binary
+      expect(packed.unpack("d*")).to eq(compare_with.flatten)
+      expect(mat.to_str).to eq(packed)
+      expect(mat.transpose.to_binary.unpack("d*")).to eq(compare_with.transpose.flatten)
+      expect(mat.partial(1, 2, 1, 1).to_binary.unpack("d*")).to eq(compare_with[1][1..2])
+    end
+    it 'is imported with from_binary' do
+      packed = compare_with.flatten.pack("d*")
+      expect(mat_type::from_binary(*params[:rc], packed).to_a).to eq(compare_with)
+      expect(mat_type::from_binary(*params[:rc], mat).to_a).to eq(compare_with)
+      expect{mat_type::from_binary(*params[:rc], packed[0..-2])}.to raise_error(ArgumentError)
+      expect{mat_type::from_binary(*params[:rc], compare_with)}.to raise_error(ArgumentError)
+    end
+  end
+
+  describe 'bulk iteration' do
+    let(:compare_with){ params[:rc][0].times.map{params[:rc][1].times.map{gen_elm.call - 0.5} } }
+    let(:mat){mat_type::new(compare_with)}
+    it 'supports each_row' do
+      rows = []
+      expect(mat.each_row{|row, i| rows << [row, i]}).to be(mat)
+      expect(rows.collect{|row, i| [row.unpack("d*"), i]}).to eq(compare_with.each_with_index.to_a)
+      expect(mat.each_row.to_a).to eq(rows)
+      expect(mat.t.each_row.collect{|row, i| row.unpack("d*")}).to eq(compare_with.transpose)
+    end
+    it 'supports map_rows and map_packed' do
+      expect(mat.map_rows{|row, i| row.unpack("d*").collect{|v| v * i}}.to_a) \
+          .to eq(compare_with.each_with_index.collect{|row, i| row.collect{|v| v * i}})
+      expect(mat.map_rows{|row, i| row}.to_a).to eq(compare_with)
+      expect{mat.map_rows{|row, i| row[1..-1]}}.to raise_error(ArgumentError)
+      expect{mat.map_rows{|row, i| row + row}}.to raise_error(ArgumentError)
+      expect{mat.map_rows{|row, i| row.unpack("d*")[1..-1]}}.to raise_error(ArgumentError)
+      expect(mat.map_packed{|packed, r, c|
+        expect([r, c]).to eq(params[:rc])
+        packed.unpack("d*").collect{|v| -v}.pack("d*")
+      }.to_a).to eq(compare_with.collect{|row| row.collect{|v| -v}})
+      expect{mat.map_packed{|packed, r, c| packed[0..-2]}}.to raise_error(ArgumentError)
+    end
+    it 'supports native elementwise operations' do
+      {
+        :abs => proc{|v| v.abs},
+        :exp => proc{|v| Math::exp(v)},
+        [:clamp, -0.25, 0.25] => proc{|v| v.clamp(-0.25, 0.25)},
+        [:scale, 3] => proc{|v| v * 3},
+      }.each{|(func, *args), f|
+        expect(mat.send(func, *args).to_a).to eq(compare_with.collect{|row| row.collect(&f)})
+      }
+      expect(mat.abs.sqrt.to_a).to eq(compare_with.collect{|row| row.collect{|v| Math::sqrt(v.abs)}})
+      expect(mat.t.abs.to_a).to eq(compare_with.transpose.collect{|row| row.collect{|v| v.abs}})
+      expect{mat.clamp(1, -1)}.to raise_error(ArgumentError)
+    end
+  end
 end
 
 RSpec::describe GPS_PVT::SylphideMath::MatrixComplexD do
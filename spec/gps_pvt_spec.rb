@@ -742,6 +742,24 @@ __RINEX_CLK_TEXT__
         }
       }.to_a.sort).to eq(meas.to_a.sort)
       expect(meas.to_hash2.to_meas.to_a.sort).to eq(meas.to_a.sort)
+      GPS::Measurement::new.tap{|meas2| # reuse after clear, unsorted input, and user defined keys
+        meas2.add(1, GPS::Measurement::ITEMS_PREDEFINED + 1, 0)
+        meas2.clear
+        expect(meas2.to_a).to eq([])
+        meas.to_a.reverse.each{|prn, k, v| meas2.add(prn, k, v)}
+        expect(meas2.to_a).to eq(meas.to_a.sort)
+        [-1, GPS::Measurement::ITEMS_PREDEFINED].each{|k| meas2.add(meas.to_a[0][0], k, k)}
+        expect(meas2.to_hash[meas.to_a[0][0]]).to include(-1 => -1, GPS::Measurement::ITEMS_PREDEFINED => GPS::Measurement::ITEMS_PREDEFINED)
+      }
+      GPS::Measurement::new.tap{|meas2| # bulk addition
+        prns, keys, values = meas.to_a.transpose
+        expect(meas2.add_packed(prns, keys, values.pack("d*"))).to eq(values.size)
+        expect(meas2.to_a).to eq(meas.to_a)
+        meas2.clear
+        meas2.add_packed(prns, keys.collect{|k| meas.class.constants.find{|sym| meas.class.const_get(sym) == k}}, values)
+        expect(meas2.to_a).to eq(meas.to_a)
+        expect{meas2.add_packed(prns, keys, values[0..-2])}.to raise_error(ArgumentError)
+      }
       expect{GPS::Measurement::new({:sym => {1 => 2}})}.to raise_error(TypeError)
       expect{GPS::Measurement::new({1 => {:sym => 2}})}.to raise_error(TypeError)
       expect{GPS::Measurement::new({1 => [2, 3]})}.to raise_error(TypeError)
@@ -852,8 +870,34 @@ __RINEX_CLK_TEXT__
         expect(a).to be_within(1E-10).of(b)
       }
       expect([:rows, :columns].collect{|f| pvt.slope_HV_enu.send(f)}).to eq([6, 2])
+      pvt.S.tap{|mat_S| # returned matrices are independent of the cached ones
+        expect(pvt.slope_HV_enu(mat_S).to_a).to eq(pvt.slope_HV_enu.to_a)
+        mat_S[0, 0] += 1
+        expect(pvt.S[0, 0]).not_to eq(mat_S[0, 0])
+      }
+      [:slope_HV, :slope_HV_enu].each{|k|
+        pvt.send(k).tap{|mat| # cached slopes are returned as copies
+          expect(mat.to_a).to eq(pvt.send(k, pvt.S).to_a)
+          mat[0, 0] += 1
+          expect(pvt.send(k)[0, 0]).not_to eq(mat[0, 0])
+        }
+      }
+      [:G, :W, :delta_r, :G_enu, :C, :C_enu, :S, :S_enu].each{|k|
+        expect(pvt.to_packed(k).unpack("d*")).to eq(pvt.send(k).to_a.flatten)
+      }
+      expect{pvt.to_packed(:unknown)}.to raise_error(ArgumentError)
+      expect(pvt.other_state).to eq((pvt.S * pvt.delta_r).to_a.flatten[4..-1])
       expect(pvt.used_satellites).to eq(6)
       expect(pvt.used_satellite_list).to eq([12, 18, 24, 25, 29, 31])
+      views = proc{ # views of a PVT, which is not referred from the spec afterwards
+        pvt2 = solver.solve(meas, t_meas)
+        [:G, :W, :delta_r].collect{|k| [pvt2.send(k), pvt2.send(k).to_a]}
+      }.call
+      GC.start
+      views.each{|view, values|
+        expect(view).to be_frozen
+        expect(view.to_a).to eq(values)
+      }
 
       meas.each{|prn, k, v|
         solver.gps_options.exclude(prn)
@@ -964,6 +1008,293 @@ __RINEX_CLK_TEXT__
         end
       }
     end
+    it 'solves epochs at once with solve_batch as well as one by one' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      meas_list, t_list = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a.transpose
+      pvt_list = meas_list.zip(t_list).collect{|meas, t_meas| solver.solve(meas, t_meas)}
+      expect(pvt_list.all?{|pvt| pvt.position_solved?}).to eq(true)
+      batch = solver.solve_batch(meas_list, t_list)
+      expect(batch[:epochs]).to eq(pvt_list.size)
+      expect(batch[:error_code]).to eq(pvt_list.collect{|pvt| pvt.error_code})
+      expect(batch[:used_satellite_list]).to eq(pvt_list.collect{|pvt| pvt.used_satellite_list})
+      batch[:xyz].unpack("d*").each_slice(3).zip(pvt_list).each{|xyz, pvt|
+        xyz.zip(pvt.xyz.to_a).each{|a, b|
+          expect(a).to be_within(1E-3).of(b)
+        }
+      }
+      batch[:dop].unpack("d*").each_slice(5).zip(pvt_list).each{|dop, pvt|
+        dop.zip([:gdop, :pdop, :hdop, :vdop, :tdop].collect{|k| pvt.send(k)}).each{|a, b|
+          expect(a).to be_within(1E-6).of(b)
+        }
+      }
+    end
+    it 'serializes solve_batch and solve called concurrently on one solver' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      solver.options = {:tracking => true} # stateful between epochs
+      meas_list, t_list = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a.transpose
+      ref = solver.solve_batch(meas_list, t_list)
+      solver.options = {:tracking => true} # reset state
+      res = 4.times.collect{|i|
+        Thread::new{
+          solver.options = {:tracking => true} if i.even?
+          if i < 2 then
+            solver.solve_batch(meas_list, t_list)
+          else
+            meas_list.zip(t_list).collect{|meas, t_meas| solver.solve(meas, t_meas).position_solved?}
+          end
+        }
+      }.collect{|th| th.value}
+      res[0..1].each{|batch|
+        expect(batch[:epochs]).to eq(ref[:epochs])
+        expect(batch[:error_code]).to eq(ref[:error_code])
+        batch[:xyz].unpack("d*").zip(ref[:xyz].unpack("d*")).each{|a, b|
+          expect(a).to be_within(1E-2).of(b)
+        }
+      }
+      res[2..3].each{|solved| expect(solved.all?).to eq(true)}
+    end
+    it 'allows hooks to call the solver and space nodes to be updated during solve_batch' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      meas_list, t_list = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a.transpose
+      nested = []
+      solver.hooks[:update_position_solution] = proc{|mat_G, mat_W, mat_delta_r, temp_pvt|
+        next unless nested.empty? # once, otherwise infinite recursion
+        nested << nil
+        nested[0] = solver.solve(meas_list[0], t_list[0]).position_solved?
+      }
+      expect(solver.solve(meas_list[0], t_list[0]).position_solved?).to eq(true)
+      expect(nested).to eq([true])
+      solver.hooks.clear
+      ref = solver.solve_batch(meas_list, t_list)
+      th = Thread::new{solver.solve_batch(meas_list, t_list)}
+      10.times{ # mutators wait for the task running without GVL
+        solver.gps_space_node.update_all_ephemeris(t_list[0])
+        solver.gps_space_node.read(input[:rinex_nav])
+      }
+      expect(th.value[:error_code]).to eq(ref[:error_code])
+    end
+    it 'reads RINEX nav file into all space nodes in one pass' do
+      expect(solver.read_rinex_nav(input[:rinex_nav])).to eq(GPS::SpaceNode::new.read(input[:rinex_nav]))
+      t0 = GPS::Time::new(1849, 172800)
+      [solver.gps_space_node, GPS::SpaceNode::new.tap{|sn| sn.read(input[:rinex_nav])}].each{|sn|
+        sn.update_all_ephemeris(t0)
+      }.collect{|sn|
+        sn.ephemeris(12).constellation(t0)[0].to_a
+      }.transpose.each{|a, b|
+        expect(a).to eq(b)
+      }
+    end
+    it 'calculates DOP map with selectable precision' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      meas, t_meas = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).first
+      pvt = solver.solve(meas, t_meas)
+      expect(pvt.position_solved?).to eq(true)
+      rcv = pvt.xyz.to_a
+      sats = pvt.G.to_a.collect{|g| rcv.zip(g).collect{|v, dv| v - dv * 2E7}} # G: satellite => receiver
+      q = (pvt.G_enu.t * pvt.G_enu).inv
+      ref = [[0, 1, 2, 3], [0, 1, 2], [0, 1], [2], [3]].collect{|idxs|
+        Math::sqrt(idxs.collect{|i| q[i, i]}.sum)
+      }
+      {:float => 1E-4, :double => 1E-8, :long_double => 1E-8}.each{|prec, delta|
+        dop = GPS::Solver::dop_map([rcv, rcv], sats.flatten.pack("d*"),
+            {:elevation_mask => -Math::PI / 2, :precision => prec}).unpack("d*")
+        expect(dop.size).to eq(10)
+        dop.zip(ref * 2).each{|a, b| expect(a).to be_within(delta).of(b)}
+      }
+      expect(GPS::Solver::dop_map([rcv], sats).unpack("d*")).to eq(GPS::Solver::dop_map([rcv], sats, {:precision => :double}).unpack("d*"))
+      expect(GPS::Solver::dop_map([rcv], sats[0..2]).unpack("d*").all?{|v| v.nan?}).to eq(true)
+      expect(GPS::Solver::dop_map([rcv], sats, {:elevation_mask => Math::PI / 2}).unpack("d*").all?{|v| v.nan?}).to eq(true)
+      expect{GPS::Solver::dop_map([rcv], sats, {:precision => :half})}.to raise_error(ArgumentError)
+      expect{GPS::Solver::dop_map([rcv[0..1]], sats)}.to raise_error(ArgumentError)
+    end
+    it 'refreshes ephemeris selection when ephemeris is added' do
+      meas, t_meas = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).first
+      expect(solver.solve(meas, t_meas).position_solved?).to eq(false)
+      solver.read_rinex_nav(input[:rinex_nav])
+      expect(solver.solve(meas, t_meas).position_solved?).to eq(true)
+      [1, 3, 5, 7].collect{|hr| t_meas + 60 * 60 * hr}.each{|t| # across ephemeris boundaries
+        solver2 = GPS::Solver::new.tap{|obj| obj.read_rinex_nav(input[:rinex_nav])}
+        pvt, pvt2 = [solver, solver2].collect{|obj| obj.solve(meas, t)}
+        expect(pvt.position_solved?).to eq(pvt2.position_solved?)
+        expect(pvt.used_satellite_list).to eq(pvt2.used_satellite_list)
+        next unless pvt.position_solved?
+        pvt.xyz.to_a.zip(pvt2.xyz.to_a).each{|a, b| expect(a).to be_within(1E-3).of(b)}
+      }
+    end
+    it 'refreshes ephemeris selection when newer ephemeris arrives during validity' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      meas, t_meas = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).first
+      pvt0 = solver.solve(meas, t_meas)
+      expect(pvt0.position_solved?).to eq(true)
+      prn = pvt0.used_satellite_list[0]
+      eph = solver.gps_space_node.ephemeris(prn)
+      expect(eph.valid?(t_meas + 60)).to eq(true) # still valid at the next solution
+      eph.a_f0 += 1E-6 # approx. 300 m in range
+      GPS::SpaceNode::new.register_ephemeris(prn, eph, 0x100) # not owned by solver
+      solver2 = GPS::Solver::new.tap{|obj| obj.read_rinex_nav(input[:rinex_nav])}
+      [solver, solver2].each{|obj| obj.gps_space_node.register_ephemeris(prn, eph, 0x100)}
+      [60, 60 * 60].collect{|sec| t_meas + sec}.each.with_index{|t, i|
+        pvt, pvt2 = [solver, solver2].collect{|obj| obj.solve(meas, t)}
+        expect(solver.gps_space_node.ephemeris(prn).a_f0).to eq(eph.a_f0) if i == 0
+        expect(pvt.position_solved?).to eq(pvt2.position_solved?)
+        next unless pvt.position_solved?
+        pvt.xyz.to_a.zip(pvt2.xyz.to_a).each{|a, b| expect(a).to be_within(1E-3).of(b)}
+      }
+    end
+    it 'seeds solution with the previous one in tracking mode' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      epochs = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a
+      expect(solver.options[:tracking]).to eq(false)
+      pvt_ref = epochs.collect{|meas, t_meas| solver.solve(meas, t_meas)}
+      solver.options = {:tracking => true}
+      expect(solver.options).to include(:tracking => true)
+      epochs.zip(pvt_ref).each{|(meas, t_meas), pvt0|
+        pvt = solver.solve(meas, t_meas)
+        expect(pvt.position_solved?).to eq(pvt0.position_solved?)
+        next unless pvt.position_solved?
+        pvt.xyz.to_a.zip(pvt0.xyz.to_a).each{|a, b| expect(a).to be_within(1E-3).of(b)}
+        expect(pvt.receiver_error).to be_within(1E-3).of(pvt0.receiver_error)
+      }
+    end
+    it 'limits position iterations of seeded epochs in tracking mode' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      epochs = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a
+      pvt_ref = epochs.collect{|meas, t_meas| solver.solve(meas, t_meas)}
+      expect(solver.options[:tracking_iteration_max]).to eq(0)
+      solver.options = {:tracking => true, :tracking_iteration_max => 1, :skip_exclusion => true}
+      expect(solver.options).to include(:tracking => true, :tracking_iteration_max => 1)
+      counts = []
+      solver.hooks[:update_position_solution] = proc{counts[-1] += 1}
+      epochs.zip(pvt_ref).each.with_index{|((meas, t_meas), pvt0), i|
+        counts << 0
+        pvt = solver.solve(meas, t_meas)
+        expect(pvt.position_solved?).to eq(pvt0.position_solved?)
+        next unless pvt.position_solved?
+        expect(counts[-1]).to (i == 0 ? be > 1 : eq(1)) # 1st epoch is not seeded
+        pvt.xyz.to_a.zip(pvt0.xyz.to_a).each{|a, b| expect(a).to be_within(1E-1).of(b)}
+      }
+    end
+    it 'estimates solution recursively in EKF mode' do
+      solver.read_rinex_nav(input[:rinex_nav])
+      epochs = GPS::RINEX_Observation::read_measurement(input[:rinex_obs]).to_a
+      pvt_ref = epochs.collect{|meas, t_meas| solver.solve(meas, t_meas)}
+      expect(solver.options[:ekf]).to eq(false)
+      expect{solver.options = {:ekf => true, :ekf_q_acceleration => 2.0}}.not_to raise_error
+      expect(solver.options).to include(:ekf => true, :ekf_q_acceleration => 2.0)
+      epochs.zip(pvt_ref).each.with_index{|((meas, t_meas), pvt0), i|
+        pvt = solver.solve(meas, t_meas)
+        expect(pvt.position_solved?).to eq(pvt0.position_solved?)
+        next unless pvt.position_solved?
+        if i == 0 then # initialized with LSR
+          expect(pvt.xyz.to_a).to eq(pvt0.xyz.to_a)
+          next
+        end
+        # static receiver; filtered solution stays close to the snapshot one with bounded uncertainty
+        expect(Math::sqrt(pvt.xyz.to_a.zip(pvt0.xyz.to_a).collect{|a, b| (a - b) ** 2}.sum)).to be < 1E1
+        expect(pvt.hsigma).to be_between(0, 1E1).exclusive
+        q = (pvt.G_enu.t * pvt.G_enu).inv
+        {:gdop => [0, 1, 2, 3], :pdop => [0, 1, 2], :hdop => [0, 1], :vdop => [2], :tdop => [3]}.each{|k, idxs|
+          expect(pvt.send(k)).to be_within(1E-8).of(Math::sqrt(idxs.collect{|j| q[j, j]}.sum))
+        }
+      }
+      solver.hooks[:update_position_solution] = proc{}
+      expect{solver.solve(*epochs[-1])}.to raise_error(RuntimeError, /EKF/)
+    end
+    it 'reads RINEX obs file into measurements directly' do
+      items = GPS::RINEX_Observation::read(input[:rinex_obs]).to_a
+      c1_idx = (items[0][:meas_types]['G'] || items[0][:meas_types][' ']).index("C1")
+      meas_list, t_list, glonass_missing_list = [[], [], []]
+      expect(GPS::RINEX_Observation::read_measurement(input[:rinex_obs]){|meas, t_meas, clk_err, glonass_missing|
+        item = items[t_list.size]
+        expect(t_meas.to_a).to eq(item[:time].to_a)
+        expect(clk_err).to eq(item[:rcv_clock_error])
+        pr = Hash[*(meas.to_a.select{|prn, k, v| k == GPS::Measurement::L1_PSEUDORANGE}.collect{|prn, k, v| [prn, v]}.flatten)]
+        item[:meas].each{|(sys, prn), v|
+          next unless sys == 'G'
+          expect(pr[prn]).to eq(v[c1_idx] && v[c1_idx][0])
+        }
+        meas_list << meas.to_a
+        t_list << t_meas
+        glonass_missing_list << (glonass_missing || [])
+      }).to eq(3)
+      blocks = GPS::RINEX_Observation::read_packed(input[:rinex_obs], 2).to_a
+      expect(blocks.collect{|blk| blk[:epochs]}).to eq([2, 1])
+      expect(blocks.collect{|blk|
+        blk[:week].unpack("i*").zip(blk[:seconds].unpack("d*"))
+      }.flatten(1)).to eq(t_list.collect{|t| t.to_a})
+      expect(blocks.collect{|blk|
+        missing = Array::new(blk[:epochs]){[]}
+        blk[:glonass_freq_missing].unpack("i*").each_slice(2){|i, prn| missing[i] << prn}
+        missing
+      }.flatten(1)).to eq(glonass_missing_list)
+      blocks.collect{|blk|
+        offset = blk[:offset].unpack("i*")
+        expect(offset.size).to eq(blk[:epochs] + 1)
+        rows = [blk[:prn].unpack("i*"), blk[:key].unpack("i*"), blk[:value].unpack("d*")].transpose
+        offset.each_cons(2).collect{|a, b| rows[a...b].sort}
+      }.flatten(1).zip(meas_list).each{|a, b|
+        expect(a).to eq(b)
+      }
+    end
+    it 'reads RINEX, SP3 and RINEX clock files from in-memory buffer or stream' do
+      require 'stringio'
+      [:rinex_nav, :rinex_obs, :sp3, :rinex_clk].each{|k|
+        expect{GPS::SP3::new.read(nil)}.to raise_error(TypeError) if k == :sp3
+        buf = StringIO::new(open(input[k], 'rb'){|io| io.read})
+        case k
+        when :rinex_nav
+          expect(GPS::SpaceNode::new.read(buf)).to eq(GPS::SpaceNode::new.read(input[k]))
+        when :rinex_obs
+          expect(GPS::RINEX_Observation::read(buf).collect{|item| item[:time].to_a}) \
+              .to eq(GPS::RINEX_Observation::read(input[k]).collect{|item| item[:time].to_a})
+          require 'zlib'
+          gz = Zlib::GzipReader::new(StringIO::new(Zlib::gzip(buf.string))) # streaming decompression
+          expect(GPS::RINEX_Observation::read_measurement(gz).collect{|meas, t| t.to_a}) \
+              .to eq(GPS::RINEX_Observation::read(input[k]).collect{|item| item[:time].to_a})
+          io_error = Object::new.tap{|obj| obj.define_singleton_method(:read){|*args| raise IOError}}
+          expect{GPS::RINEX_Observation::read_measurement(io_error){}}.to raise_error(IOError)
+          io_large = Object::new.tap{|obj| # returns more than requested length at once
+            comments = "%-60sCOMMENT\n"%["padding"] * 1000 # > 64KiB
+            content = [buf.string.sub(/^(?=.*END OF HEADER)/){comments}]
+            obj.define_singleton_method(:read){|*args| content.shift}
+          }
+          expect(GPS::RINEX_Observation::read_measurement(io_large).collect{|meas, t| t.to_a}) \
+              .to eq(GPS::RINEX_Observation::read(input[k]).collect{|item| item[:time].to_a})
+        when :sp3
+          expect(GPS::SP3::new.read(buf)).to eq(32 * 9)
+        when :rinex_clk
+          expect(GPS::RINEX_Clock::new.read(buf)).to eq(6 * 7)
+        end
+      }
+    end
+    it 'calculates GLONASS satellite position with cached integration' do
+      eph = GPS::Ephemeris_GLONASS::new.tap{|obj|
+        obj.svid = 1
+        obj.freq_ch = 1
+        obj.set_date(7, 100) # N_4, NA
+        obj.t_b = 900 * 40
+        { # nearly circular orbit, whose radius is 25510 km, and inclination is 64.8 deg
+          :xn => 25510E3, :yn => 0, :zn => 0,
+          :xn_dot => 0, :yn_dot => 3953 * Math::cos(64.8 / 180 * Math::PI), :zn_dot => 3953 * Math::sin(64.8 / 180 * Math::PI),
+          :xn_ddot => 0, :yn_ddot => 0, :zn_ddot => 0,
+        }.each{|k, v| obj.send("#{k}=", v)}
+      }
+      check = proc{|dt| # tolerance: position 1E-2 m, velocity 1E-5 m/s
+        t = eph.base_time + dt
+        cached, uncached = [true, false].collect{|use_cache|
+          eph.constellation(t, 0, use_cache)[0..1].collect{|xyz| xyz.to_a}
+        }
+        cached.zip(uncached, [1E-2, 1E-5]).each{|a, b, delta|
+          a.zip(b).each{|v1, v2| expect(v1).to be_within(delta).of(v2)}
+        }
+      }
+      (0..1800).step(100).each{|dt| check.call(dt)} # forward
+      [1500, 350, 1750, 10, -100].each{|dt| check.call(dt)} # backward
+      eph.t_b += 900 # t_b change
+      [1800, 200, 1200].each{|dt| check.call(dt)}
+      eph.xn += 1E3 # state change
+      [1200, 1500].each{|dt| check.call(dt)}
+    end
     it 'calculates satellites position based on SP3 with ANTEX' do
       sp3, sn = [GPS::SP3::new, solver.gps_space_node]
       expect(sp3.read(input[:sp3])).to eq(32 * 9)
@@ -1089,5 +1420,24 @@ __RINEX_CLK_TEXT__
         receiver.parse_rinex_obs(input[:rinex_obs]){|pvt, meas| }
       }.to output(/3 epochs\./).to_stderr
     end
+    it 'outputs geometric information of EKF solutions' do
+      receiver = GPS_PVT::Receiver::new(:ekf => 'on')
+      receiver.parse_rinex_nav(input[:rinex_nav])
+      expect{
+        receiver.parse_rinex_obs(input[:rinex_obs]){|pvt, (meas, t_meas)|
+          expect(pvt.position_solved?).to eq(true)
+          n = pvt.used_satellites
+          expect(pvt.used_satellite_list.size).to eq(n)
+          expect([pvt.G, pvt.W, pvt.delta_r].collect{|mat| [mat.rows, mat.columns]}) \
+              .to eq([[n, 4], [n, n], [n, 1]])
+          expect(pvt.to_s.split(/,/).size).to be > n
+          expect(pvt.S.rows).to eq(4)
+          expect(pvt.C.rows).to eq(4)
+          expect(pvt.azimuth.keys).to eq(pvt.used_satellite_list)
+          expect(pvt.slope_HV_enu.rows).to eq(n)
+          expect(pvt.other_state).to be_empty
+        }
+      }.to output(/3 epochs\./).to_stderr
+    end
   end
 end
\ No newline at end of file